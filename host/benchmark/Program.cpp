@@ -0,0 +1,536 @@
+/**
+ * @file      Program.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Benchmarks of the system layer on the Linux host build.
+ *
+ * Each benchmark prints min/avg/p99/max of its samples in nanoseconds of the host
+ * monotonic clock. An interrupt is simulated by the FreeRTOS tick hook, which
+ * the POSIX port calls from the tick signal handler.
+ */
+#include "Program.hpp"
+#include "sys.Call.hpp"
+#include "sys.Semaphore.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <time.h>
+
+namespace eoos
+{
+namespace
+{
+
+/**
+ * @brief Number of samples of a benchmark.
+ */
+const int32_t NUMBER_OF_SAMPLES = 1000;
+
+/**
+ * @brief Number of operations measured by one sample of short operations.
+ */
+const int32_t NUMBER_OF_OPERATIONS = 100;
+
+/**
+ * @brief Returns time of the host monotonic clock.
+ *
+ * @return Time in nanoseconds.
+ */
+int64_t getTime()
+{
+    struct ::timespec time;
+    static_cast<void>( ::clock_gettime(CLOCK_MONOTONIC, &time) );
+    return static_cast<int64_t>(time.tv_sec) * 1000000000LL + static_cast<int64_t>(time.tv_nsec);
+}
+
+/**
+ * @class Samples
+ * @brief Samples of a benchmark.
+ */
+class Samples
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param name A benchmark name.
+     */
+    explicit Samples(char_t const* name)
+        : name_( name )
+        , number_( 0 )
+        , values_() {
+    }
+
+    /**
+     * @brief Adds a sample.
+     *
+     * @param value A sample in nanoseconds.
+     */
+    void add(int64_t value)
+    {
+        if( number_ < NUMBER_OF_SAMPLES )
+        {
+            values_[number_] = value;
+            number_++;
+        }
+    }
+
+    /**
+     * @brief Prints statistics of the samples.
+     */
+    void report()
+    {
+        if( number_ == 0 )
+        {
+            std::printf("%-40s no samples\n", name_);
+            return;
+        }
+        std::sort(values_, values_ + number_);
+        int64_t sum( 0 );
+        for(int32_t i( 0 ); i < number_; i++)
+        {
+            sum += values_[i];
+        }
+        int32_t index( (number_ * 99) / 100 );
+        if( index >= number_ )
+        {
+            index = number_ - 1;
+        }
+        std::printf("%-40s count %4d, min %9lld, avg %9lld, p99 %9lld, max %9lld ns\n",
+            name_, static_cast<int>(number_),
+            static_cast<long long>(values_[0]),
+            static_cast<long long>(sum / number_),
+            static_cast<long long>(values_[index]),
+            static_cast<long long>(values_[number_ - 1]));
+    }
+
+private:
+
+    /**
+     * @brief The benchmark name.
+     */
+    char_t const* name_;
+
+    /**
+     * @brief Number of samples.
+     */
+    int32_t number_;
+
+    /**
+     * @brief The samples.
+     */
+    int64_t values_[NUMBER_OF_SAMPLES];
+
+};
+
+/**
+ * @class Job
+ * @brief Task of benchmark threads.
+ */
+class Job : public api::Task
+{
+
+public:
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const
+    {
+        return true;
+    }
+
+    /**
+     * @copydoc eoos::api::Task::getStackSize()
+     */
+    virtual size_t getStackSize() const
+    {
+        return sys::Configuration::THREAD_STACK_SIZE;
+    }
+
+};
+
+/**
+ * @class Empty
+ * @brief Task which returns at once.
+ */
+class Empty : public Job
+{
+
+public:
+
+    /**
+     * @copydoc eoos::api::Runnable::start()
+     */
+    virtual void start()
+    {
+    }
+
+};
+
+/**
+ * @class Echo
+ * @brief Task which releases one semaphore on each acquired permit of another one.
+ */
+class Echo : public Job
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param ping A semaphore to acquire.
+     * @param pong A semaphore to release.
+     */
+    Echo(api::Semaphore& ping, api::Semaphore& pong)
+        : ping_( ping )
+        , pong_( pong )
+        , isStopped_( false ) {
+    }
+
+    /**
+     * @copydoc eoos::api::Runnable::start()
+     */
+    virtual void start()
+    {
+        while( ping_.acquire() && !isStopped_ )
+        {
+            static_cast<void>( pong_.release() );
+        }
+    }
+
+    /**
+     * @brief Stops the task.
+     */
+    void stop()
+    {
+        isStopped_ = true;
+        static_cast<void>( ping_.release() );
+    }
+
+private:
+
+    /**
+     * @brief The semaphore to acquire.
+     */
+    api::Semaphore& ping_;
+
+    /**
+     * @brief The semaphore to release.
+     */
+    api::Semaphore& pong_;
+
+    /**
+     * @brief Stop flag.
+     */
+    bool_t volatile isStopped_;
+
+};
+
+/**
+ * @class Spinner
+ * @brief Task which yields till it is stopped.
+ */
+class Spinner : public Job
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param scheduler The scheduler.
+     */
+    explicit Spinner(api::Scheduler& scheduler)
+        : scheduler_( scheduler )
+        , isStopped_( false ) {
+    }
+
+    /**
+     * @copydoc eoos::api::Runnable::start()
+     */
+    virtual void start()
+    {
+        while( !isStopped_ )
+        {
+            static_cast<void>( scheduler_.yield() );
+        }
+    }
+
+    /**
+     * @brief Stops the task.
+     */
+    void stop()
+    {
+        isStopped_ = true;
+    }
+
+private:
+
+    /**
+     * @brief The scheduler.
+     */
+    api::Scheduler& scheduler_;
+
+    /**
+     * @brief Stop flag.
+     */
+    bool_t volatile isStopped_;
+
+};
+
+/**
+ * @class Interrupt
+ * @brief Simulated interrupt which releases a semaphore from the tick hook.
+ */
+class Interrupt
+{
+
+public:
+
+    /**
+     * @brief Requests the semaphore release on the next tick.
+     *
+     * @param semaphore A semaphore to release.
+     */
+    static void raise(sys::Semaphore& semaphore)
+    {
+        semaphore_ = &semaphore;
+    }
+
+    /**
+     * @brief Handles the tick.
+     */
+    static void handle()
+    {
+        sys::Semaphore* const semaphore( semaphore_ );
+        if( semaphore != NULLPTR )
+        {
+            semaphore_ = NULLPTR;
+            time_ = getTime();
+            static_cast<void>( semaphore->releaseFromInterrupt() );
+        }
+    }
+
+    /**
+     * @brief Returns time of the last release.
+     *
+     * @return Time in nanoseconds.
+     */
+    static int64_t getReleaseTime()
+    {
+        return time_;
+    }
+
+private:
+
+    /**
+     * @brief A semaphore to release.
+     */
+    static sys::Semaphore* volatile semaphore_;
+
+    /**
+     * @brief Time of the last release.
+     */
+    static int64_t volatile time_;
+
+};
+
+sys::Semaphore* volatile Interrupt::semaphore_( NULLPTR );
+int64_t volatile Interrupt::time_( 0 );
+
+/**
+ * @brief Measures thread create, execute and join.
+ */
+void benchmarkThread()
+{
+    static Samples samples("Thread create/execute/join");
+    api::Scheduler& scheduler( sys::Call::get().getScheduler() );
+    Empty task;
+    for(int32_t i( 0 ); i < NUMBER_OF_SAMPLES; i++)
+    {
+        int64_t const begin( getTime() );
+        api::Thread* const thread( scheduler.createThread(task) );
+        if( thread == NULLPTR )
+        {
+            break;
+        }
+        static_cast<void>( thread->execute() );
+        static_cast<void>( thread->join() );
+        delete thread;
+        samples.add( getTime() - begin );
+    }
+    samples.report();
+}
+
+/**
+ * @brief Measures mutex lock and unlock.
+ */
+void benchmarkMutex()
+{
+    static Samples samples("Mutex lock/unlock");
+    api::Mutex* const mutex( sys::Call::get().getMutexManager().create() );
+    if( mutex != NULLPTR )
+    {
+        for(int32_t i( 0 ); i < NUMBER_OF_SAMPLES; i++)
+        {
+            int64_t const begin( getTime() );
+            for(int32_t j( 0 ); j < NUMBER_OF_OPERATIONS; j++)
+            {
+                static_cast<void>( mutex->lock() );
+                static_cast<void>( mutex->unlock() );
+            }
+            samples.add( (getTime() - begin) / NUMBER_OF_OPERATIONS );
+        }
+        delete mutex;
+    }
+    samples.report();
+}
+
+/**
+ * @brief Measures semaphore ping-pong between two threads.
+ */
+void benchmarkSemaphore()
+{
+    static Samples samples("Semaphore ping-pong round-trip");
+    api::System& system( sys::Call::get() );
+    api::Semaphore* const ping( system.getSemaphoreManager().create(0) );
+    api::Semaphore* const pong( system.getSemaphoreManager().create(0) );
+    if( (ping != NULLPTR) && (pong != NULLPTR) )
+    {
+        Echo task(*ping, *pong);
+        api::Thread* const thread( system.getScheduler().createThread(task) );
+        if( (thread != NULLPTR) && thread->execute() )
+        {
+            for(int32_t i( 0 ); i < NUMBER_OF_SAMPLES; i++)
+            {
+                int64_t const begin( getTime() );
+                static_cast<void>( ping->release() );
+                static_cast<void>( pong->acquire() );
+                samples.add( getTime() - begin );
+            }
+            task.stop();
+            static_cast<void>( thread->join() );
+        }
+        delete thread;
+    }
+    delete ping;
+    delete pong;
+    samples.report();
+}
+
+/**
+ * @brief Measures the oversleep of a thread.
+ *
+ * @param samples Samples of the benchmark.
+ * @param ms      Time to sleep in milliseconds.
+ * @param number  Number of samples.
+ */
+void benchmarkSleep(Samples& samples, int32_t ms, int32_t number)
+{
+    api::Scheduler& scheduler( sys::Call::get().getScheduler() );
+    for(int32_t i( 0 ); i < number; i++)
+    {
+        int64_t const begin( getTime() );
+        static_cast<void>( scheduler.sleep(ms) );
+        samples.add( getTime() - begin - static_cast<int64_t>(ms) * 1000000LL );
+    }
+    samples.report();
+}
+
+/**
+ * @brief Measures the output stream.
+ */
+void benchmarkStream()
+{
+    static Samples samples("Stream write of 16 characters");
+    api::OutStream<char_t>& cout( sys::Call::get().getStreamManager().getCout() );
+    for(int32_t i( 0 ); i < NUMBER_OF_SAMPLES; i++)
+    {
+        int64_t const begin( getTime() );
+        for(int32_t j( 0 ); j < NUMBER_OF_OPERATIONS; j++)
+        {
+            cout << "0123456789ABCDEF";
+        }
+        static_cast<void>( cout.flush() );
+        samples.add( (getTime() - begin) / NUMBER_OF_OPERATIONS );
+    }
+    samples.report();
+}
+
+/**
+ * @brief Measures the yield round-trip through a thread of the same priority.
+ */
+void benchmarkYield()
+{
+    static Samples samples("Yield round-trip");
+    api::Scheduler& scheduler( sys::Call::get().getScheduler() );
+    Spinner task(scheduler);
+    api::Thread* const thread( scheduler.createThread(task) );
+    if( (thread != NULLPTR) && thread->execute() )
+    {
+        for(int32_t i( 0 ); i < NUMBER_OF_SAMPLES; i++)
+        {
+            int64_t const begin( getTime() );
+            static_cast<void>( scheduler.yield() );
+            samples.add( getTime() - begin );
+        }
+        task.stop();
+        static_cast<void>( thread->join() );
+    }
+    delete thread;
+    samples.report();
+}
+
+/**
+ * @brief Measures the latency from a semaphore released by an interrupt to the waiting thread woken.
+ */
+void benchmarkInterrupt()
+{
+    static Samples samples("Release from interrupt to thread woken");
+    sys::Semaphore semaphore(sys::Semaphore::TYPE_BINARY);
+    if( semaphore.isConstructed() )
+    {
+        for(int32_t i( 0 ); i < NUMBER_OF_SAMPLES; i++)
+        {
+            Interrupt::raise(semaphore);
+            static_cast<void>( semaphore.acquire() );
+            samples.add( getTime() - Interrupt::getReleaseTime() );
+        }
+    }
+    samples.report();
+}
+
+} // namespace
+
+int32_t Program::start(int32_t, char_t*[])
+{
+    benchmarkThread();
+    benchmarkMutex();
+    benchmarkSemaphore();
+    static Samples sleep1("Sleep 1 ms oversleep");
+    benchmarkSleep(sleep1, 1, 200);
+    static Samples sleep10("Sleep 10 ms oversleep");
+    benchmarkSleep(sleep10, 10, 100);
+    benchmarkStream();
+    benchmarkYield();
+    benchmarkInterrupt();
+    static_cast<void>( std::fflush(stdout) );
+    // The FreeRTOS scheduler does not return on the host, thus the process is terminated here
+    std::exit(0);
+    return 0;
+}
+
+} // namespace eoos
+
+/**
+ * @brief Simulates an interrupt on each system tick.
+ */
+extern "C" void vApplicationTickHook(void)
+{
+    ::eoos::Interrupt::handle();
+}
@@ -0,0 +1,85 @@
+/**
+ * @file      FreeRTOSConfig.h
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief FreeRTOS configuration of the Linux host build on the POSIX port.
+ *
+ * @note The file is C compatible as the kernel sources include it.
+ */
+#ifndef FREERTOSCONFIG_H_
+#define FREERTOSCONFIG_H_
+
+#define configUSE_PREEMPTION                    1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
+#define configUSE_TICKLESS_IDLE                 0
+#define configTICK_RATE_HZ                      ( 1000 )
+#define configMAX_PRIORITIES                    ( 16 )
+#define configMINIMAL_STACK_SIZE                ( ( unsigned short ) 4096 )
+#define configMAX_TASK_NAME_LEN                 ( 16 )
+#define configTICK_TYPE_WIDTH_IN_BITS           TICK_TYPE_WIDTH_32_BITS
+#define configIDLE_SHOULD_YIELD                 1
+#define configUSE_TASK_NOTIFICATIONS            1
+#define configUSE_MUTEXES                       1
+#define configUSE_RECURSIVE_MUTEXES             1
+#define configUSE_COUNTING_SEMAPHORES           1
+#define configQUEUE_REGISTRY_SIZE               0
+#define configUSE_TIME_SLICING                  1
+#define configNUM_THREAD_LOCAL_STORAGE_POINTERS 4
+#define configSTACK_DEPTH_TYPE                  uint32_t
+
+#define configSUPPORT_STATIC_ALLOCATION         1
+#define configSUPPORT_DYNAMIC_ALLOCATION        1
+#define configTOTAL_HEAP_SIZE                   ( 1024 * 1024 )
+
+#define configUSE_IDLE_HOOK                     0
+#define configUSE_TICK_HOOK                     1
+#define configCHECK_FOR_STACK_OVERFLOW          0
+#define configUSE_MALLOC_FAILED_HOOK            0
+
+#define configGENERATE_RUN_TIME_STATS           1
+#define configUSE_TRACE_FACILITY                1
+#define configUSE_STATS_FORMATTING_FUNCTIONS    0
+
+#define configUSE_TIMERS                        1
+#define configTIMER_TASK_PRIORITY               ( configMAX_PRIORITIES - 1 )
+#define configTIMER_QUEUE_LENGTH                32
+#define configTIMER_TASK_STACK_DEPTH            configMINIMAL_STACK_SIZE
+
+#define INCLUDE_vTaskPrioritySet                1
+#define INCLUDE_uxTaskPriorityGet               1
+#define INCLUDE_vTaskDelete                     1
+#define INCLUDE_vTaskSuspend                    1
+#define INCLUDE_vTaskDelayUntil                 1
+#define INCLUDE_xTaskDelayUntil                 1
+#define INCLUDE_vTaskDelay                      1
+#define INCLUDE_xTaskGetSchedulerState          1
+#define INCLUDE_xTaskGetCurrentTaskHandle       1
+#define INCLUDE_uxTaskGetStackHighWaterMark     1
+#define INCLUDE_xTaskGetIdleTaskHandle          1
+#define INCLUDE_eTaskGetState                   1
+#define INCLUDE_xTimerPendFunctionCall          1
+#define INCLUDE_xSemaphoreGetMutexHolder        1
+#define INCLUDE_xQueueGetMutexHolder            1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Returns the run time counter of the host.
+ *
+ * @return Time in microseconds.
+ */
+unsigned long eoos_port_get_run_time_counter(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#define portGET_RUN_TIME_COUNTER_VALUE()        eoos_port_get_run_time_counter()
+
+#include "sys.Trace.h"
+
+#endif // FREERTOSCONFIG_H_
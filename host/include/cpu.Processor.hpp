@@ -0,0 +1,201 @@
+/**
+ * @file      cpu.Processor.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef CPU_PROCESSOR_HPP_
+#define CPU_PROCESSOR_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "api.CpuProcessor.hpp"
+
+namespace eoos
+{
+namespace cpu
+{
+
+/**
+ * @class Processor
+ * @brief CPU processor stub of the Linux host build.
+ *
+ * The FreeRTOS POSIX port owns the system tick and context switching, thus the timer
+ * and interrupt resources are accepted by the system but never fire. The stub implements
+ * the members which the system layer calls.
+ */
+class Processor : public sys::NonCopyable<sys::NoAllocator>, public api::CpuProcessor
+{
+    typedef sys::NonCopyable<sys::NoAllocator> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    Processor();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Processor();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @copydoc eoos::api::CpuProcessor::getTimerController()
+     */
+    virtual api::CpuTimerController& getTimerController();
+
+    /**
+     * @copydoc eoos::api::CpuProcessor::getInterruptController()
+     */
+    virtual api::CpuInterruptController& getInterruptController();
+
+private:
+
+    /**
+     * @class Timer
+     * @brief Timer resource which never fires.
+     */
+    class Timer : public api::CpuTimer
+    {
+
+    public:
+
+        /**
+         * @brief Constructor.
+         */
+        Timer();
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~Timer();
+
+        /**
+         * @copydoc eoos::api::Object::isConstructed()
+         */
+        virtual bool_t isConstructed() const;
+
+        /**
+         * @copydoc eoos::api::CpuTimer::setPeriod(int64_t)
+         */
+        virtual bool_t setPeriod(int64_t us);
+
+        /**
+         * @copydoc eoos::api::CpuTimer::start()
+         */
+        virtual void start();
+
+        /**
+         * @copydoc eoos::api::CpuTimer::stop()
+         */
+        virtual void stop();
+
+    };
+
+    /**
+     * @class Interrupt
+     * @brief Interrupt resource which never fires.
+     */
+    class Interrupt : public api::CpuInterrupt
+    {
+
+    public:
+
+        /**
+         * @brief Constructor.
+         */
+        Interrupt();
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~Interrupt();
+
+        /**
+         * @copydoc eoos::api::Object::isConstructed()
+         */
+        virtual bool_t isConstructed() const;
+
+        /**
+         * @copydoc eoos::api::CpuInterrupt::enable()
+         */
+        virtual void enable();
+
+        /**
+         * @copydoc eoos::api::CpuInterrupt::disable()
+         */
+        virtual void disable();
+
+    };
+
+    /**
+     * @class TimerController
+     * @brief Timer controller.
+     */
+    class TimerController : public api::CpuTimerController
+    {
+
+    public:
+
+        /**
+         * @copydoc eoos::api::CpuTimerController::getNumberSystick()
+         */
+        virtual int32_t getNumberSystick();
+
+        /**
+         * @copydoc eoos::api::CpuTimerController::createResource(int32_t)
+         */
+        virtual api::CpuTimer* createResource(int32_t number);
+
+    };
+
+    /**
+     * @class InterruptController
+     * @brief Interrupt controller.
+     */
+    class InterruptController : public api::CpuInterruptController
+    {
+
+    public:
+
+        /**
+         * @copydoc eoos::api::CpuInterruptController::getNumberSystick()
+         */
+        virtual int32_t getNumberSystick();
+
+        /**
+         * @copydoc eoos::api::CpuInterruptController::getNumberSupervisor()
+         */
+        virtual int32_t getNumberSupervisor();
+
+        /**
+         * @copydoc eoos::api::CpuInterruptController::getNumberPendSupervisor()
+         */
+        virtual int32_t getNumberPendSupervisor();
+
+        /**
+         * @copydoc eoos::api::CpuInterruptController::createResource(api::Runnable&,int32_t)
+         */
+        virtual api::CpuInterrupt* createResource(api::Runnable& handler, int32_t source);
+
+    };
+
+    /**
+     * @brief The timer controller.
+     */
+    TimerController tim_;
+
+    /**
+     * @brief The interrupt controller.
+     */
+    InterruptController int_;
+
+};
+
+} // namespace cpu
+} // namespace eoos
+#endif // CPU_PROCESSOR_HPP_
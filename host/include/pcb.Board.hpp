@@ -0,0 +1,47 @@
+/**
+ * @file      pcb.Board.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PCB_BOARD_HPP_
+#define PCB_BOARD_HPP_
+
+#include "sys.NonCopyable.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+/**
+ * @class Board
+ * @brief Printed circuit board of the Linux host build.
+ *
+ * The host has no board peripherals to initialize.
+ */
+class Board : public sys::NonCopyable<sys::NoAllocator>
+{
+    typedef sys::NonCopyable<sys::NoAllocator> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    Board();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Board();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+};
+
+} // namespace pcb
+} // namespace eoos
+#endif // PCB_BOARD_HPP_
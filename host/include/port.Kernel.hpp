@@ -0,0 +1,82 @@
+/**
+ * @file      port.Kernel.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief FreeRTOS kernel port of the Linux host build.
+ */
+#ifndef PORT_KERNEL_HPP_
+#define PORT_KERNEL_HPP_
+
+#include "api.CpuProcessor.hpp"
+
+/**
+ * @brief Interrupts are simulated in the tick hook, where the POSIX port switches context
+ *        after the hook if an unblocked task has a higher priority, thus no yield is needed.
+ */
+#undef portYIELD_FROM_ISR
+#define portYIELD_FROM_ISR()
+
+namespace eoos
+{
+namespace port
+{
+
+/**
+ * @class Kernel
+ * @brief FreeRTOS kernel port on the POSIX simulator.
+ *
+ * The POSIX port drives the system tick by a signal and switches context by threads,
+ * thus the kernel does not use the CPU timer and interrupts.
+ */
+class Kernel
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param cpu The CPU processor.
+     */
+    explicit Kernel(api::CpuProcessor& cpu);
+
+    /**
+     * @brief Destructor.
+     */
+    ~Kernel();
+
+    /**
+     * @brief Tests if this object has been constructed.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t isConstructed() const;
+
+    /**
+     * @brief Starts the FreeRTOS scheduler.
+     */
+    void execute();
+
+private:
+
+    /**
+     * @brief Copy constructor.
+     */
+    Kernel(Kernel const&);
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    Kernel& operator=(Kernel const&);
+
+    /**
+     * @brief The CPU processor.
+     */
+    api::CpuProcessor& cpu_;
+
+};
+
+} // namespace port
+} // namespace eoos
+#endif // PORT_KERNEL_HPP_
@@ -0,0 +1,117 @@
+/**
+ * @file      cpu.Processor.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "cpu.Processor.hpp"
+
+namespace eoos
+{
+namespace cpu
+{
+
+Processor::Processor()
+    : sys::NonCopyable<sys::NoAllocator>()
+    , api::CpuProcessor()
+    , tim_()
+    , int_() {
+}
+
+Processor::~Processor()
+{
+}
+
+bool_t Processor::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+api::CpuTimerController& Processor::getTimerController()
+{
+    return tim_;
+}
+
+api::CpuInterruptController& Processor::getInterruptController()
+{
+    return int_;
+}
+
+Processor::Timer::Timer()
+    : api::CpuTimer() {
+}
+
+Processor::Timer::~Timer()
+{
+}
+
+bool_t Processor::Timer::isConstructed() const
+{
+    return true;
+}
+
+bool_t Processor::Timer::setPeriod(int64_t)
+{
+    return true;
+}
+
+void Processor::Timer::start()
+{
+}
+
+void Processor::Timer::stop()
+{
+}
+
+Processor::Interrupt::Interrupt()
+    : api::CpuInterrupt() {
+}
+
+Processor::Interrupt::~Interrupt()
+{
+}
+
+bool_t Processor::Interrupt::isConstructed() const
+{
+    return true;
+}
+
+void Processor::Interrupt::enable()
+{
+}
+
+void Processor::Interrupt::disable()
+{
+}
+
+int32_t Processor::TimerController::getNumberSystick()
+{
+    return 0;
+}
+
+api::CpuTimer* Processor::TimerController::createResource(int32_t)
+{
+    return new Timer();
+}
+
+int32_t Processor::InterruptController::getNumberSystick()
+{
+    return 0;
+}
+
+int32_t Processor::InterruptController::getNumberSupervisor()
+{
+    return 1;
+}
+
+int32_t Processor::InterruptController::getNumberPendSupervisor()
+{
+    return 2;
+}
+
+api::CpuInterrupt* Processor::InterruptController::createResource(api::Runnable&, int32_t)
+{
+    return new Interrupt();
+}
+
+} // namespace cpu
+} // namespace eoos
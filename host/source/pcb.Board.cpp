@@ -0,0 +1,27 @@
+/**
+ * @file      pcb.Board.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "pcb.Board.hpp"
+
+namespace eoos
+{
+namespace pcb
+{
+
+Board::Board()
+    : sys::NonCopyable<sys::NoAllocator>() {
+}
+
+Board::~Board()
+{
+}
+
+bool_t Board::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+} // namespace pcb
+} // namespace eoos
@@ -0,0 +1,75 @@
+/**
+ * @file      port.Kernel.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.Types.hpp"
+#include "port.Kernel.hpp"
+#include <time.h>
+
+namespace eoos
+{
+namespace port
+{
+
+Kernel::Kernel(api::CpuProcessor& cpu)
+    : cpu_( cpu ) {
+}
+
+Kernel::~Kernel()
+{
+}
+
+bool_t Kernel::isConstructed() const
+{
+    return cpu_.isConstructed();
+}
+
+void Kernel::execute()
+{
+    ::vTaskStartScheduler();
+}
+
+} // namespace port
+} // namespace eoos
+
+/**
+ * @brief Idle task memory.
+ */
+static ::StaticTask_t idleTask;
+
+/**
+ * @brief Idle task stack.
+ */
+static ::StackType_t idleStack[configMINIMAL_STACK_SIZE];
+
+/**
+ * @brief Timer daemon task memory.
+ */
+static ::StaticTask_t timerTask;
+
+/**
+ * @brief Timer daemon task stack.
+ */
+static ::StackType_t timerStack[configTIMER_TASK_STACK_DEPTH];
+
+extern "C" void vApplicationGetIdleTaskMemory(::StaticTask_t** ppxIdleTaskTCBBuffer, ::StackType_t** ppxIdleTaskStackBuffer, configSTACK_DEPTH_TYPE* puxIdleTaskStackSize)
+{
+    *ppxIdleTaskTCBBuffer = &idleTask;
+    *ppxIdleTaskStackBuffer = idleStack;
+    *puxIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+
+extern "C" void vApplicationGetTimerTaskMemory(::StaticTask_t** ppxTimerTaskTCBBuffer, ::StackType_t** ppxTimerTaskStackBuffer, configSTACK_DEPTH_TYPE* puxTimerTaskStackSize)
+{
+    *ppxTimerTaskTCBBuffer = &timerTask;
+    *ppxTimerTaskStackBuffer = timerStack;
+    *puxTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
+}
+
+extern "C" unsigned long eoos_port_get_run_time_counter(void)
+{
+    struct ::timespec time;
+    static_cast<void>( ::clock_gettime(CLOCK_MONOTONIC, &time) );
+    return static_cast<unsigned long>(time.tv_sec) * 1000000UL + static_cast<unsigned long>(time.tv_nsec / 1000L);
+}
@@ -0,0 +1,307 @@
+/**
+ * @file      sys.BudgetManager.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_BUDGETMANAGER_HPP_
+#define SYS_BUDGETMANAGER_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "api.Runnable.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+class Scheduler;
+
+/**
+ * @class BudgetManager
+ * @brief Per-thread CPU budgets enforced by the system tick.
+ *
+ * Each tick is charged to the thread which was running when the tick interrupt
+ * occurred. If a thread uses more ticks than its budget within the budget period,
+ * the budget is marked as exceeded, and the thread can be demoted to the EOOS
+ * minimum priority till the period ends. Demotion, restoration and the overrun
+ * routine are done by the FreeRTOS timer daemon task, therefore the routine
+ * shall not block. A demoted thread is restored to the base priority it had
+ * when the budget was attached.
+ */
+class BudgetManager : public NonCopyable<NoAllocator>, public api::Runnable
+{
+    typedef NonCopyable<NoAllocator> Parent;
+
+public:
+
+    /**
+     * @class Budget
+     * @brief CPU budget of a thread.
+     */
+    class Budget : public NonCopyable<NoAllocator>
+    {
+        typedef NonCopyable<NoAllocator> Parent;
+
+        friend class BudgetManager;
+
+    public:
+
+        /**
+         * @enum Action
+         * @brief Action on the budget overrun.
+         */
+        enum Action
+        {
+            ACTION_FLAG,
+            ACTION_DEMOTE
+        };
+
+        /**
+         * @brief Constructor.
+         *
+         * @param budget  CPU time in milliseconds a thread may use within the period.
+         * @param period  The budget period in milliseconds.
+         * @param action  An action on the budget overrun.
+         * @param routine A routine called on each overrun, or NULLPTR.
+         */
+        Budget(int32_t budget, int32_t period, Action action, api::Runnable* routine);
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~Budget();
+
+        /**
+         * @copydoc eoos::api::Object::isConstructed()
+         */
+        virtual bool_t isConstructed() const;
+
+        /**
+         * @brief Tests if the budget is exceeded within the current period.
+         *
+         * @return True if exceeded.
+         */
+        bool_t isExceeded() const;
+
+        /**
+         * @brief Returns number of periods the budget was exceeded in.
+         *
+         * @return Number of overruns.
+         */
+        uint32_t getOverruns() const;
+
+        /**
+         * @brief Returns number of ticks used by the thread in the last complete period.
+         *
+         * @return Number of ticks.
+         */
+        ::TickType_t getUsage() const;
+
+    protected:
+
+        using Parent::setConstructed;
+
+    private:
+
+        /**
+         * @brief Budget in ticks.
+         */
+        ::TickType_t budget_;
+
+        /**
+         * @brief Period in ticks.
+         */
+        ::TickType_t period_;
+
+        /**
+         * @brief Ticks elapsed in the current period.
+         */
+        ::TickType_t elapsed_;
+
+        /**
+         * @brief Ticks used in the current period.
+         */
+        ::TickType_t used_;
+
+        /**
+         * @brief Ticks used in the last complete period.
+         */
+        ::TickType_t usage_;
+
+        /**
+         * @brief Action on the budget overrun.
+         */
+        Action action_;
+
+        /**
+         * @brief Overrun routine.
+         */
+        api::Runnable* routine_;
+
+        /**
+         * @brief The thread FreeRTOS task.
+         */
+        ::TaskHandle_t task_;
+
+        /**
+         * @brief FreeRTOS base priority of the thread when the budget was attached.
+         */
+        ::UBaseType_t priority_;
+
+        /**
+         * @brief Number of overruns.
+         */
+        uint32_t overruns_;
+
+        /**
+         * @brief The budget is exceeded in the current period flag.
+         */
+        bool_t isExceeded_;
+
+        /**
+         * @brief The thread is demoted flag.
+         */
+        bool_t isDemoted_;
+
+        /**
+         * @brief The overrun routine is to be called by the timer daemon flag.
+         */
+        bool_t isToReport_;
+
+        /**
+         * @brief The thread priority is to be updated by the timer daemon flag.
+         */
+        bool_t isToUpdate_;
+
+        /**
+         * @brief The manager the budget is attached to.
+         */
+        BudgetManager* manager_;
+
+        /**
+         * @brief Next budget.
+         */
+        Budget* next_;
+
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @param scheduler The operating system scheduler.
+     */
+    BudgetManager(Scheduler& scheduler);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~BudgetManager();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Charges the system tick to the running thread.
+     */
+    virtual void start();
+
+    /**
+     * @brief Attaches a budget to the calling thread.
+     *
+     * @param budget A budget.
+     * @return True if attached.
+     */
+    bool_t attach(Budget& budget);
+
+    /**
+     * @brief Detaches a budget, and restores the thread priority if it is demoted.
+     *
+     * If the timer daemon is handling the budget, the call waits until it is done.
+     *
+     * @param budget A budget.
+     * @return True if detached.
+     */
+    bool_t detach(Budget& budget);
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @param scheduler The operating system scheduler.
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct(Scheduler& scheduler);
+
+    /**
+     * @brief Hooks this manager to the system tick if it is not hooked yet.
+     *
+     * @return True if the manager is hooked.
+     */
+    bool_t activate();
+
+    /**
+     * @brief Handles budget events by the timer daemon.
+     */
+    void handle();
+
+    /**
+     * @brief Returns the base priority of a task, which is not inherited from a mutex.
+     *
+     * The priority of a FreeRTOS task which is not an EOOS thread might be inherited,
+     * if the kernel does not provide the base priority.
+     *
+     * @param task A FreeRTOS task.
+     * @return The FreeRTOS priority.
+     */
+    static ::UBaseType_t getBasePriority(::TaskHandle_t task);
+
+    /**
+     * @brief Handles budget events by the timer daemon.
+     *
+     * @param pvParameter1 The manager.
+     * @param ulParameter2 Unused.
+     */
+    static void handle(void* pvParameter1, uint32_t ulParameter2);
+
+    /**
+     * @brief The operating system scheduler.
+     */
+    Scheduler& scheduler_;
+
+    /**
+     * @brief FreeRTOS priority a thread is demoted to.
+     */
+    ::UBaseType_t priorityMin_;
+
+    /**
+     * @brief Attached budgets.
+     */
+    Budget* head_;
+
+    /**
+     * @brief Budget the timer daemon is handling.
+     */
+    Budget* handling_;
+
+    /**
+     * @brief Handling is pended to the timer daemon flag.
+     */
+    bool_t isPended_;
+
+    /**
+     * @brief This manager is hooked to the system tick flag.
+     */
+    bool_t isActive_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_BUDGETMANAGER_HPP_
@@ -0,0 +1,316 @@
+/**
+ * @file      sys.ConditionVariableResource.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_CONDITIONVARIABLERESOURCE_HPP_
+#define SYS_CONDITIONVARIABLERESOURCE_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.TimeMap.hpp"
+#include "api.Mutex.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ConditionVariableResource
+ * @brief Condition variable resource class.
+ *
+ * A waiting thread is blocked on one counting semaphore, and a notification
+ * gives the semaphore once per thread being woken up. As the mutex is released
+ * by one unlock call, it shall be locked by the waiting thread only once.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class ConditionVariableResource : public NonCopyable<A>
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    ConditionVariableResource();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~ConditionVariableResource();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Releases the mutex and blocks until notified, then locks the mutex again.
+     *
+     * @param mutex A mutex locked by the caller.
+     * @return True if the thread has been notified.
+     */
+    bool_t wait(api::Mutex& mutex);
+
+    /**
+     * @brief Releases the mutex and blocks until notified or timed out, then locks the mutex again.
+     *
+     * @param mutex A mutex locked by the caller.
+     * @param ms    A time to wait in milliseconds.
+     * @return True if the thread has been notified, or false if the time expired.
+     */
+    bool_t wait(api::Mutex& mutex, int32_t ms);
+
+    /**
+     * @brief Wakes up one waiting thread.
+     *
+     * @return True if no errors occurred.
+     */
+    bool_t notifyOne();
+
+    /**
+     * @brief Wakes up all waiting threads.
+     *
+     * @return True if no errors occurred.
+     */
+    bool_t notifyAll();
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Initializes kernel semaphore resource.
+     *
+     * @return True if initialized sucessfully.
+     */
+    bool_t initialize();
+
+    /**
+     * @brief Deinitializes kernel semaphore resource.
+     */
+    void deinitialize();
+
+    /**
+     * @brief Waits for a notification.
+     *
+     * @param mutex A mutex locked by the caller.
+     * @param ticks A time to wait in ticks.
+     * @return True if the thread has been notified.
+     */
+    bool_t waitFor(api::Mutex& mutex, ::TickType_t ticks);
+
+    /**
+     * @brief Gives permits to notified threads.
+     *
+     * @param number Number of notified threads.
+     * @return True if all the permits have been given.
+     */
+    bool_t give(int32_t number);
+
+    /**
+     * @brief Max number of waiting threads.
+     */
+    static const int32_t MAX_WAITERS = 0x7FFFFFFF;
+
+    /**
+     * @brief Number of threads which are waiting and have not been notified.
+     */
+    int32_t waiters_;
+
+    /**
+     * @brief Semaphore FreeRTOS resource.
+     */
+    ::SemaphoreHandle_t sem_;
+
+    /**
+     * @brief Semaphore FreeRTOS statatic buffer.
+     */
+    ::StaticSemaphore_t buffer_;
+
+};
+
+template <class A>
+ConditionVariableResource<A>::ConditionVariableResource()
+    : NonCopyable<A>()
+    , waiters_( 0 )
+    , sem_( NULL )
+    , buffer_() {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+ConditionVariableResource<A>::~ConditionVariableResource()
+{
+    deinitialize();
+}
+
+template <class A>
+bool_t ConditionVariableResource<A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t ConditionVariableResource<A>::wait(api::Mutex& mutex)
+{
+    return waitFor(mutex, portMAX_DELAY);
+}
+
+template <class A>
+bool_t ConditionVariableResource<A>::wait(api::Mutex& mutex, int32_t ms)
+{
+    return waitFor(mutex, TimeMap::toTicks(ms));
+}
+
+template <class A>
+bool_t ConditionVariableResource<A>::notifyOne()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        taskENTER_CRITICAL();
+        int32_t const number( (waiters_ > 0) ? 1 : 0 );
+        waiters_ -= number;
+        taskEXIT_CRITICAL();
+        res = give(number);
+    }
+    return res;
+}
+
+template <class A>
+bool_t ConditionVariableResource<A>::notifyAll()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        taskENTER_CRITICAL();
+        int32_t const number( waiters_ );
+        waiters_ = 0;
+        taskEXIT_CRITICAL();
+        res = give(number);
+    }
+    return res;
+}
+
+template <class A>
+bool_t ConditionVariableResource<A>::construct()
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {   ///< UT Justified Branch: HW dependency
+            break;
+        }
+        if( !initialize() )
+        {
+            break;
+        }
+        res = true;
+    } while(false);
+    return res;
+}
+
+template <class A>
+bool_t ConditionVariableResource<A>::initialize()
+{
+    ::UBaseType_t const uxMaxCount( static_cast<::UBaseType_t>(MAX_WAITERS) );
+    sem_ = ::xSemaphoreCreateCountingStatic(uxMaxCount, 0, &buffer_);
+    return sem_ != NULL;
+}
+
+template <class A>
+void ConditionVariableResource<A>::deinitialize()
+{
+    if( sem_ != NULL )
+    {
+        ::vSemaphoreDelete(sem_);
+        sem_ = NULL;
+    }
+}
+
+template <class A>
+bool_t ConditionVariableResource<A>::waitFor(api::Mutex& mutex, ::TickType_t ticks)
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        taskENTER_CRITICAL();
+        bool_t const isWaiter( waiters_ < MAX_WAITERS );
+        if( isWaiter )
+        {
+            waiters_++;
+        }
+        taskEXIT_CRITICAL();
+        if( !isWaiter )
+        {
+            break;
+        }
+        if( !mutex.unlock() )
+        {
+            taskENTER_CRITICAL();
+            waiters_--;
+            taskEXIT_CRITICAL();
+            break;
+        }
+        ::BaseType_t isTaken( ::xSemaphoreTake(sem_, ticks) );
+        if( isTaken != pdPASS )
+        {
+            // If a notifier has counted this thread out of the waiters before it stops waiting,
+            // the notifier gives the permit for this thread, so the permit has to be consumed.
+            taskENTER_CRITICAL();
+            bool_t const isNotified( waiters_ == 0 );
+            if( !isNotified )
+            {
+                waiters_--;
+            }
+            taskEXIT_CRITICAL();
+            if( isNotified )
+            {
+                isTaken = ::xSemaphoreTake(sem_, portMAX_DELAY);
+            }
+        }
+        if( !mutex.lock() )
+        {
+            break;
+        }
+        res = (isTaken == pdPASS) ? true : false;
+    } while(false);
+    return res;
+}
+
+template <class A>
+bool_t ConditionVariableResource<A>::give(int32_t number)
+{
+    bool_t res( true );
+    for(int32_t i(0); i<number; i++)
+    {
+        if( ::xSemaphoreGive(sem_) != pdPASS )
+        {
+            res = false;
+        }
+    }
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_CONDITIONVARIABLERESOURCE_HPP_
@@ -0,0 +1,149 @@
+/**
+ * @file      sys.Configuration.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief System compile-time configuration.
+ */
+#ifndef SYS_CONFIGURATION_HPP_
+#define SYS_CONFIGURATION_HPP_
+
+#include "sys.Types.hpp"
+
+/**
+ * @brief Fails compilation if a constant expression is false.
+ *
+ * @param expr A constant expression.
+ * @param msg  A message of the failure.
+ */
+#if EOOS_CPP_STANDARD >= 2011
+    #define EOOS_SYS_STATIC_ASSERT(expr, msg) static_assert(expr, msg)
+#else
+    #define EOOS_SYS_STATIC_ASSERT_CONCAT_(a, b) a##b
+    #define EOOS_SYS_STATIC_ASSERT_CONCAT(a, b) EOOS_SYS_STATIC_ASSERT_CONCAT_(a, b)
+    #define EOOS_SYS_STATIC_ASSERT(expr, msg) typedef char EOOS_SYS_STATIC_ASSERT_CONCAT(StaticAssert_, __LINE__)[(expr) ? 1 : -1]
+#endif // EOOS_CPP_STANDARD >= 2011
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @struct Configuration
+ * @brief System descriptor which sizes all resources at compile time.
+ *
+ * The descriptor is built from the EOOS_GLOBAL_SYS_* definitions, and all classes
+ * take their sizes from it. Wrong values break the build, and the whole
+ * statically allocated system memory is checked against EOOS_GLOBAL_SYS_MEMORY_SIZE.
+ */
+struct Configuration
+{
+    /**
+     * @brief Number of threads in the pool.
+     */
+    static const int32_t NUMBER_OF_THREADS = EOOS_GLOBAL_SYS_NUMBER_OF_THREADS;
+
+    /**
+     * @brief Number of mutexes in the pool.
+     */
+    static const int32_t NUMBER_OF_MUTEXS = EOOS_GLOBAL_SYS_NUMBER_OF_MUTEXS;
+
+    /**
+     * @brief Number of reader-writer locks in the pool.
+     */
+    static const int32_t NUMBER_OF_RWLOCKS = EOOS_GLOBAL_SYS_NUMBER_OF_RWLOCKS;
+
+    /**
+     * @brief Number of semaphores in the pool.
+     */
+    static const int32_t NUMBER_OF_SEMAPHORES = EOOS_GLOBAL_SYS_NUMBER_OF_SEMAPHORES;
+
+    /**
+     * @brief Number of software timers in the pool.
+     */
+    static const int32_t NUMBER_OF_TIMERS = EOOS_GLOBAL_SYS_NUMBER_OF_TIMERS;
+
+    /**
+     * @brief Number of event groups in the pool.
+     */
+    static const int32_t NUMBER_OF_EVENT_GROUPS = EOOS_GLOBAL_SYS_NUMBER_OF_EVENT_GROUPS;
+
+    /**
+     * @brief Number of routines hooked to the system tick.
+     */
+    static const int32_t NUMBER_OF_TICK_HOOKS = EOOS_GLOBAL_SYS_NUMBER_OF_TICK_HOOKS;
+
+    /**
+     * @brief Number of mutex contention records.
+     */
+    static const int32_t NUMBER_OF_MUTEX_TRACES = EOOS_GLOBAL_SYS_NUMBER_OF_MUTEX_TRACES;
+
+    /**
+     * @brief Number of thread records of the watchdog diagnostics.
+     */
+    static const int32_t NUMBER_OF_WATCHDOG_RECORDS = EOOS_GLOBAL_SYS_NUMBER_OF_WATCHDOG_RECORDS;
+
+    /**
+     * @brief Period of the watchdog supervisor in milliseconds.
+     */
+    static const int32_t WATCHDOG_PERIOD = EOOS_GLOBAL_SYS_WATCHDOG_PERIOD;
+
+    /**
+     * @brief Number of thread records of the crash record.
+     */
+    static const int32_t NUMBER_OF_CRASH_THREADS = EOOS_GLOBAL_SYS_NUMBER_OF_CRASH_THREADS;
+
+    /**
+     * @brief Number of kernel trace records of the crash record.
+     */
+    static const uint32_t NUMBER_OF_CRASH_TRACES = EOOS_GLOBAL_SYS_NUMBER_OF_CRASH_TRACES;
+
+    /**
+     * @brief Number of the timer wheel slots.
+     */
+    static const uint32_t TIMER_WHEEL_SLOTS = EOOS_GLOBAL_SYS_TIMER_WHEEL_SLOTS;
+
+    /**
+     * @brief Number of the kernel trace records.
+     */
+    static const uint32_t TRACE_RECORDS = EOOS_GLOBAL_SYS_TRACE_RECORDS;
+
+    /**
+     * @brief Default stack size of a thread in bytes.
+     */
+    static const size_t THREAD_STACK_SIZE = EOOS_GLOBAL_SYS_FREERTOS_TASK_STACK_SIZE;
+
+    /**
+     * @brief Minimal stack size of a thread in bytes.
+     */
+    static const size_t THREAD_STACK_SIZE_MIN = configMINIMAL_STACK_SIZE * sizeof(::StackType_t);
+
+    /**
+     * @brief Memory available for the system object in bytes, or zero if not limited.
+     */
+    static const size_t MEMORY_SIZE = EOOS_GLOBAL_SYS_MEMORY_SIZE;
+
+};
+
+EOOS_SYS_STATIC_ASSERT(Configuration::NUMBER_OF_THREADS >= 0, "EOOS_GLOBAL_SYS_NUMBER_OF_THREADS shall not be negative");
+EOOS_SYS_STATIC_ASSERT(Configuration::NUMBER_OF_MUTEXS >= 0, "EOOS_GLOBAL_SYS_NUMBER_OF_MUTEXS shall not be negative");
+EOOS_SYS_STATIC_ASSERT(Configuration::NUMBER_OF_RWLOCKS >= 0, "EOOS_GLOBAL_SYS_NUMBER_OF_RWLOCKS shall not be negative");
+EOOS_SYS_STATIC_ASSERT(Configuration::NUMBER_OF_SEMAPHORES >= 0, "EOOS_GLOBAL_SYS_NUMBER_OF_SEMAPHORES shall not be negative");
+EOOS_SYS_STATIC_ASSERT(Configuration::NUMBER_OF_TIMERS >= 0, "EOOS_GLOBAL_SYS_NUMBER_OF_TIMERS shall not be negative");
+EOOS_SYS_STATIC_ASSERT(Configuration::NUMBER_OF_EVENT_GROUPS >= 0, "EOOS_GLOBAL_SYS_NUMBER_OF_EVENT_GROUPS shall not be negative");
+EOOS_SYS_STATIC_ASSERT(Configuration::NUMBER_OF_TICK_HOOKS > 0, "EOOS_GLOBAL_SYS_NUMBER_OF_TICK_HOOKS shall be positive");
+EOOS_SYS_STATIC_ASSERT(Configuration::NUMBER_OF_MUTEX_TRACES > 0, "EOOS_GLOBAL_SYS_NUMBER_OF_MUTEX_TRACES shall be positive");
+EOOS_SYS_STATIC_ASSERT(Configuration::NUMBER_OF_WATCHDOG_RECORDS > 0, "EOOS_GLOBAL_SYS_NUMBER_OF_WATCHDOG_RECORDS shall be positive");
+EOOS_SYS_STATIC_ASSERT(Configuration::WATCHDOG_PERIOD > 0, "EOOS_GLOBAL_SYS_WATCHDOG_PERIOD shall be positive");
+EOOS_SYS_STATIC_ASSERT(Configuration::NUMBER_OF_CRASH_THREADS > 0, "EOOS_GLOBAL_SYS_NUMBER_OF_CRASH_THREADS shall be positive");
+EOOS_SYS_STATIC_ASSERT(Configuration::NUMBER_OF_CRASH_TRACES > 0, "EOOS_GLOBAL_SYS_NUMBER_OF_CRASH_TRACES shall be positive");
+EOOS_SYS_STATIC_ASSERT(Configuration::TIMER_WHEEL_SLOTS > 0, "EOOS_GLOBAL_SYS_TIMER_WHEEL_SLOTS shall be positive");
+EOOS_SYS_STATIC_ASSERT((Configuration::TIMER_WHEEL_SLOTS & (Configuration::TIMER_WHEEL_SLOTS - 1)) == 0, "EOOS_GLOBAL_SYS_TIMER_WHEEL_SLOTS shall be a power of two");
+EOOS_SYS_STATIC_ASSERT(Configuration::TRACE_RECORDS > 0, "EOOS_GLOBAL_SYS_TRACE_RECORDS shall be positive");
+EOOS_SYS_STATIC_ASSERT((Configuration::THREAD_STACK_SIZE & 0x7) == 0, "EOOS_GLOBAL_SYS_FREERTOS_TASK_STACK_SIZE shall be aligned to 8");
+EOOS_SYS_STATIC_ASSERT(Configuration::THREAD_STACK_SIZE >= Configuration::THREAD_STACK_SIZE_MIN, "EOOS_GLOBAL_SYS_FREERTOS_TASK_STACK_SIZE shall not be less than configMINIMAL_STACK_SIZE");
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_CONFIGURATION_HPP_
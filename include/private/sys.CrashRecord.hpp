@@ -0,0 +1,164 @@
+/**
+ * @file      sys.CrashRecord.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_CRASHRECORD_HPP_
+#define SYS_CRASHRECORD_HPP_
+
+#include "sys.Types.hpp"
+#include "sys.Configuration.hpp"
+#include "sys.TraceRecorder.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class CrashRecord
+ * @brief Post-mortem record of the scheduler state.
+ *
+ * The record is written when the system is terminated, and it is placed in
+ * the EOOS_GLOBAL_SYS_NOINIT_SECTION linker section to be read after the reset.
+ * The record is protected by a signature and a checksum, thus garbage
+ * of the memory after power-on is not taken as a record.
+ */
+class CrashRecord
+{
+
+public:
+
+    /**
+     * @struct Thread
+     * @brief State of a thread.
+     */
+    struct Thread
+    {
+        /**
+         * @brief Address of the thread FreeRTOS task.
+         */
+        uint32_t task;
+
+        /**
+         * @brief The task stack pointer saved on the last context switch.
+         */
+        uint32_t stack;
+
+        /**
+         * @brief Minimum amount of free stack space in words since the task started.
+         */
+        uint32_t watermark;
+
+        /**
+         * @brief The FreeRTOS task priority.
+         */
+        uint32_t priority;
+
+        /**
+         * @brief The thread name.
+         */
+        char_t name[configMAX_TASK_NAME_LEN];
+    };
+
+    /**
+     * @struct Record
+     * @brief Crash record.
+     */
+    struct Record
+    {
+        /**
+         * @brief Signature of a written record.
+         */
+        uint32_t signature;
+
+        /**
+         * @brief The system error code.
+         */
+        int32_t error;
+
+        /**
+         * @brief The kernel tick count.
+         */
+        uint32_t time;
+
+        /**
+         * @brief Address of the FreeRTOS task running on the termination.
+         */
+        uint32_t task;
+
+        /**
+         * @brief Number of thread states.
+         */
+        int32_t numberOfThreads;
+
+        /**
+         * @brief Thread states.
+         */
+        Thread threads[Configuration::NUMBER_OF_CRASH_THREADS];
+
+        #ifdef EOOS_GLOBAL_SYS_ENABLE_TRACE
+
+        /**
+         * @brief Number of kernel trace records.
+         */
+        uint32_t numberOfTraces;
+
+        /**
+         * @brief The last kernel trace records from the oldest one.
+         */
+        TraceRecorder::Record traces[Configuration::NUMBER_OF_CRASH_TRACES];
+
+        #endif // EOOS_GLOBAL_SYS_ENABLE_TRACE
+
+        /**
+         * @brief Checksum of the record.
+         */
+        uint32_t checksum;
+    };
+
+    /**
+     * @brief Writes the record.
+     *
+     * The function shall be called with interrupts disabled.
+     *
+     * @param error The system error code.
+     */
+    static void write(int32_t error);
+
+    /**
+     * @brief Returns the record written before the reset.
+     *
+     * @return The record, or NULLPTR if no record written.
+     */
+    static Record const* get();
+
+    /**
+     * @brief Clears the record.
+     */
+    static void clear();
+
+private:
+
+    /**
+     * @brief Calculates checksum of the record.
+     *
+     * @return The checksum.
+     */
+    static uint32_t calculate();
+
+    /**
+     * @brief Signature of a written record.
+     */
+    static const uint32_t SIGNATURE = 0xEC0FA11EU;
+
+    /**
+     * @brief The record.
+     */
+    static Record record_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_CRASHRECORD_HPP_
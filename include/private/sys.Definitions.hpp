@@ -43,6 +43,10 @@
     #define EOOS_GLOBAL_SYS_NUMBER_OF_MUTEXS (0)
 #endif
 
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_RWLOCKS
+    #define EOOS_GLOBAL_SYS_NUMBER_OF_RWLOCKS (0)
+#endif
+
 #ifndef EOOS_GLOBAL_SYS_NUMBER_OF_SEMAPHORES
     #define EOOS_GLOBAL_SYS_NUMBER_OF_SEMAPHORES (0)
 #endif
@@ -51,4 +55,130 @@
     #define EOOS_GLOBAL_SYS_NUMBER_OF_THREADS (0)
 #endif
 
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_TIMERS
+    #define EOOS_GLOBAL_SYS_NUMBER_OF_TIMERS (0)
+#endif
+
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_EVENT_GROUPS
+    #define EOOS_GLOBAL_SYS_NUMBER_OF_EVENT_GROUPS (0)
+#endif
+
+/**
+ * @brief Defines number of routines which can be hooked to the system tick interrupt.
+ */
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_TICK_HOOKS
+    #define EOOS_GLOBAL_SYS_NUMBER_OF_TICK_HOOKS (4)
+#endif
+
+/**
+ * @brief Defines number of slots of the system timer wheel.
+ *
+ * @note The value shall be a power of two.
+ */
+#ifndef EOOS_GLOBAL_SYS_TIMER_WHEEL_SLOTS
+    #define EOOS_GLOBAL_SYS_TIMER_WHEEL_SLOTS (64)
+#endif
+
+/**
+ * @brief Defines number of mutexes which contention statistics can be traced.
+ *
+ * @note The statistics are collected only if EOOS_GLOBAL_SYS_ENABLE_MUTEX_TRACE is defined.
+ */
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_MUTEX_TRACES
+    #define EOOS_GLOBAL_SYS_NUMBER_OF_MUTEX_TRACES (16)
+#endif
+
+/**
+ * @brief Defines number of records of the kernel trace buffer.
+ *
+ * @note The kernel events are recorded only if EOOS_GLOBAL_SYS_ENABLE_TRACE is defined,
+ *       and the records are time stamped by the run time counter, therefore 
+ *       configGENERATE_RUN_TIME_STATS has to be set to 1 in the FreeRTOS config.
+ */
+#ifndef EOOS_GLOBAL_SYS_TRACE_RECORDS
+    #define EOOS_GLOBAL_SYS_TRACE_RECORDS (256)
+#endif
+
+/**
+ * @brief Defines period in milliseconds the watchdog supervisor checks thread heartbeats with.
+ *
+ * @note The watchdog is compiled only if EOOS_GLOBAL_SYS_ENABLE_WATCHDOG is defined.
+ */
+#ifndef EOOS_GLOBAL_SYS_WATCHDOG_PERIOD
+    #define EOOS_GLOBAL_SYS_WATCHDOG_PERIOD (100)
+#endif
+
+/**
+ * @brief Defines number of threads which states are captured by the watchdog on a failure.
+ */
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_WATCHDOG_RECORDS
+    #define EOOS_GLOBAL_SYS_NUMBER_OF_WATCHDOG_RECORDS (16)
+#endif
+
+/**
+ * @brief Defines FreeRTOS task priorities of EOOS thread priorities.
+ *
+ * @note The value is an initializer list of PRIORITY_MAX + 1 elements indexed by EOOS priorities
+ *       from PRIORITY_IDLE, for example {0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 6}. If it is not defined,
+ *       EOOS priorities are spread linearly over FreeRTOS priorities from 1 to configMAX_PRIORITIES - 1.
+ */
+// #define EOOS_GLOBAL_SYS_PRIORITY_MAP {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10}
+
+/**
+ * @brief Defines size of RAM in Bytes available for the system object and all its resource pools.
+ *
+ * @note The build fails if the system object does not fit the size. Zero means no limit.
+ */
+#ifndef EOOS_GLOBAL_SYS_MEMORY_SIZE
+    #define EOOS_GLOBAL_SYS_MEMORY_SIZE (0)
+#endif
+
+/**
+ * @brief Defines name of a linker section where the system object memory is placed.
+ *
+ * @note If it is not defined, the memory is placed in a default section of zero-initialized data.
+ */
+// #define EOOS_GLOBAL_SYS_MEMORY_SECTION ".bss.eoos"
+
+/**
+ * @brief Defines name of a linker section where statically declared threads are placed.
+ *
+ * @note If it is not defined, the threads are placed in a default section of zero-initialized data.
+ */
+// #define EOOS_GLOBAL_SYS_STATIC_THREAD_SECTION ".bss.eoos.threads"
+
+/**
+ * @brief Defines name of a linker section which is not initialized on reset, where the crash record is placed.
+ *
+ * @note If it is not defined, the record is placed in a default section of zero-initialized data,
+ *       and it is not kept over a reset.
+ */
+// #define EOOS_GLOBAL_SYS_NOINIT_SECTION ".noinit"
+
+/**
+ * @brief Defines number of threads which states are written to the crash record.
+ */
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_CRASH_THREADS
+    #define EOOS_GLOBAL_SYS_NUMBER_OF_CRASH_THREADS (8)
+#endif
+
+/**
+ * @brief Defines number of the last kernel trace records written to the crash record.
+ *
+ * @note The trace records are written only if EOOS_GLOBAL_SYS_ENABLE_TRACE is defined.
+ */
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_CRASH_TRACES
+    #define EOOS_GLOBAL_SYS_NUMBER_OF_CRASH_TRACES (16)
+#endif
+
+/**
+ * @brief Enables the fast boot.
+ *
+ * @note The fast boot skips the self checks of global variables on the system construction,
+ *       unless EOOS_GLOBAL_SYS_ENABLE_VAR_CHECK is defined for debug builds, and defers
+ *       the tick hooks of the real-time and CPU budget managers and the watchdog supervisor
+ *       thread to their first use.
+ */
+// #define EOOS_GLOBAL_SYS_ENABLE_FAST_BOOT
+
 #endif // SYS_DEFINITIONS_HPP_
@@ -46,6 +46,11 @@ enum Error
      * @brief Error of a function argument.
      */
     ERROR_ARGUMENT = -5,
+
+    /**
+     * @brief Error of a thread heartbeat missed by the watchdog.
+     */
+    ERROR_WATCHDOG = -6,
     
     /**
      * @brief An undefined error has been occurred.
@@ -0,0 +1,142 @@
+/**
+ * @file      sys.EventGroupManager.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_EVENTGROUPMANAGER_HPP_
+#define SYS_EVENTGROUPMANAGER_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.Configuration.hpp"
+#include "sys.EventGroupResource.hpp"
+#include "sys.Mutex.hpp"
+#include "lib.ResourceMemory.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class EventGroupManager.
+ * @brief Event group sub-system manager.
+ */
+class EventGroupManager : public NonCopyable<NoAllocator>
+{
+    typedef NonCopyable<NoAllocator> Parent;
+
+public:
+
+    /**
+     * @brief Event group resource type.
+     */
+    typedef EventGroupResource<EventGroupManager> Resource;
+
+    /**
+     * @brief Constructor.
+     */
+    EventGroupManager();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~EventGroupManager();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Creates a new event group resource.
+     *
+     * @return A new event group resource, or NULLPTR if an error has been occurred.
+     */
+    Resource* create();
+
+    /**
+     * @brief Allocates memory.
+     *
+     * @param size Number of bytes to allocate.
+     * @return Allocated memory address or a null pointer.
+     */
+    static void* allocate(size_t size);
+
+    /**
+     * @brief Frees allocated memory.
+     *
+     * @param ptr Address of allocated memory block or a null pointer.
+     */
+    static void free(void* ptr);
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Initializes the allocator with heap for resource allocation.
+     *
+     * @param resource Heap for resource allocation.
+     * @return True if initialized.
+     */
+    static bool_t initialize(api::Heap* resource);
+
+    /**
+     * @brief Initializes the allocator.
+     */
+    static void deinitialize();
+
+    /**
+     * @struct ResourcePool
+     * @brief Resource memory pool.
+     */
+    struct ResourcePool
+    {
+
+    public:
+
+        /**
+         * @brief Constructor.
+         */
+        ResourcePool();
+
+    private:
+
+        /**
+         * @brief Mutex resource.
+         */
+        Mutex mutex_;
+
+    public:
+
+        /**
+         * @brief Event group memory allocator.
+         */
+        lib::ResourceMemory<Resource, Configuration::NUMBER_OF_EVENT_GROUPS> memory;
+
+    };
+
+    /**
+     * @brief Heap for resource allocation.
+     */
+    static api::Heap* resource_;
+
+    /**
+     * @brief Resource memory pool.
+     */
+    ResourcePool pool_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_EVENTGROUPMANAGER_HPP_
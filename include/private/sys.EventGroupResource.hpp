@@ -0,0 +1,355 @@
+/**
+ * @file      sys.EventGroupResource.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_EVENTGROUPRESOURCE_HPP_
+#define SYS_EVENTGROUPRESOURCE_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.TimeMap.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class EventGroupResource
+ * @brief Event group resource class.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class EventGroupResource : public NonCopyable<A>
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    EventGroupResource();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~EventGroupResource();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Sets event bits.
+     *
+     * @param bits Bits to set.
+     * @return True if the bits are set.
+     */
+    bool_t setBits(uint32_t bits);
+
+    /**
+     * @brief Sets event bits from interrupt service routine.
+     *
+     * @note The bits are set by the timer daemon task.
+     *
+     * @param bits Bits to set.
+     * @return True if the request is sent to the timer daemon.
+     */
+    bool_t setBitsFromInterrupt(uint32_t bits);
+
+    /**
+     * @brief Clears event bits.
+     *
+     * @param bits Bits to clear.
+     * @return True if the bits are cleared.
+     */
+    bool_t clearBits(uint32_t bits);
+
+    /**
+     * @brief Returns current event bits.
+     *
+     * @return Event bits.
+     */
+    uint32_t getBits() const;
+
+    /**
+     * @brief Waits for any of event bits.
+     *
+     * @param bits    Bits to wait for.
+     * @param isClear Clear the waited bits on exit.
+     * @return Event bits at the time the wait condition met.
+     */
+    uint32_t waitAny(uint32_t bits, bool_t isClear);
+
+    /**
+     * @brief Waits for any of event bits with a timeout.
+     *
+     * @param bits    Bits to wait for.
+     * @param isClear Clear the waited bits on exit.
+     * @param ms      A time to wait in milliseconds.
+     * @return Event bits at the time the wait condition met or the timeout expired.
+     */
+    uint32_t waitAny(uint32_t bits, bool_t isClear, int32_t ms);
+
+    /**
+     * @brief Waits for all of event bits.
+     *
+     * @param bits    Bits to wait for.
+     * @param isClear Clear the waited bits on exit.
+     * @return Event bits at the time the wait condition met.
+     */
+    uint32_t waitAll(uint32_t bits, bool_t isClear);
+
+    /**
+     * @brief Waits for all of event bits with a timeout.
+     *
+     * @param bits    Bits to wait for.
+     * @param isClear Clear the waited bits on exit.
+     * @param ms      A time to wait in milliseconds.
+     * @return Event bits at the time the wait condition met or the timeout expired.
+     */
+    uint32_t waitAll(uint32_t bits, bool_t isClear, int32_t ms);
+
+    /**
+     * @brief Test if the contex has to be switched.
+     *
+     * @return True to switch contex.
+     */
+    bool_t hasToSwitchContex() const;
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Initializes kernel event group resource.
+     *
+     * @return True if initialized sucessfully.
+     */
+    bool_t initialize();
+
+    /**
+     * @brief Deinitializes kernel event group resource.
+     */
+    void deinitialize();
+
+    /**
+     * @brief Waits for event bits.
+     *
+     * @param bits      Bits to wait for.
+     * @param isClear   Clear the waited bits on exit.
+     * @param isAll     Wait for all bits.
+     * @param ticks     A time to wait in ticks.
+     * @return Event bits.
+     */
+    uint32_t wait(uint32_t bits, bool_t isClear, bool_t isAll, ::TickType_t ticks);
+
+    /**
+     * @brief Tests bits can be used by the kernel.
+     *
+     * @param bits Bits to test.
+     * @return True if bits are valid.
+     */
+    static bool_t isBits(uint32_t bits);
+
+    /**
+     * @brief Mask of bits available for a user.
+     *
+     * @note The high byte of the kernel event bits is reserved by the kernel.
+     */
+    static const uint32_t BITS_MASK = (sizeof(::EventBits_t) == 2) ? 0x000000FFU : 0x00FFFFFFU;
+
+    /**
+     * @brief Event group FreeRTOS resource.
+     */
+    ::EventGroupHandle_t group_;
+
+    /**
+     * @brief Event group FreeRTOS statatic buffer.
+     */
+    ::StaticEventGroup_t buffer_;
+
+    /**
+     * @brief Higher priority task woken flag.
+     *
+     * The setBitsFromInterrupt() function will set the variable to pdTRUE
+     * if the request caused the timer daemon task to unblock, and the daemon
+     * has a priority higher than the currently running task. In this case
+     * a context switch should be requested before the interrupt is exited
+     * by checking the hasToSwitchContex() function.
+     */
+    ::BaseType_t xHigherPriorityTaskWoken_;
+
+};
+
+template <class A>
+EventGroupResource<A>::EventGroupResource()
+    : NonCopyable<A>()
+    , group_( NULL )
+    , buffer_()
+    , xHigherPriorityTaskWoken_( pdFALSE ) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+EventGroupResource<A>::~EventGroupResource()
+{
+    deinitialize();
+}
+
+template <class A>
+bool_t EventGroupResource<A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t EventGroupResource<A>::setBits(uint32_t bits)
+{
+    bool_t res( false );
+    if( isConstructed() && isBits(bits) )
+    {
+        static_cast<void>( ::xEventGroupSetBits(group_, static_cast<::EventBits_t>(bits)) );
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+bool_t EventGroupResource<A>::setBitsFromInterrupt(uint32_t bits)
+{
+    bool_t res( false );
+    if( isConstructed() && isBits(bits) )
+    {
+        xHigherPriorityTaskWoken_ = pdFALSE;
+        ::BaseType_t const isSent( ::xEventGroupSetBitsFromISR(group_, static_cast<::EventBits_t>(bits), &xHigherPriorityTaskWoken_) );
+        res = (isSent == pdPASS) ? true : false;
+    }
+    return res;
+}
+
+template <class A>
+bool_t EventGroupResource<A>::clearBits(uint32_t bits)
+{
+    bool_t res( false );
+    if( isConstructed() && isBits(bits) )
+    {
+        static_cast<void>( ::xEventGroupClearBits(group_, static_cast<::EventBits_t>(bits)) );
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+uint32_t EventGroupResource<A>::getBits() const
+{
+    uint32_t bits( 0 );
+    if( isConstructed() )
+    {
+        bits = static_cast<uint32_t>( ::xEventGroupGetBits(group_) );
+    }
+    return bits;
+}
+
+template <class A>
+uint32_t EventGroupResource<A>::waitAny(uint32_t bits, bool_t isClear)
+{
+    return wait(bits, isClear, false, portMAX_DELAY);
+}
+
+template <class A>
+uint32_t EventGroupResource<A>::waitAny(uint32_t bits, bool_t isClear, int32_t ms)
+{
+    return wait(bits, isClear, false, TimeMap::toTicks(ms));
+}
+
+template <class A>
+uint32_t EventGroupResource<A>::waitAll(uint32_t bits, bool_t isClear)
+{
+    return wait(bits, isClear, true, portMAX_DELAY);
+}
+
+template <class A>
+uint32_t EventGroupResource<A>::waitAll(uint32_t bits, bool_t isClear, int32_t ms)
+{
+    return wait(bits, isClear, true, TimeMap::toTicks(ms));
+}
+
+template <class A>
+bool_t EventGroupResource<A>::hasToSwitchContex() const
+{
+    return xHigherPriorityTaskWoken_ != pdFALSE;
+}
+
+template <class A>
+bool_t EventGroupResource<A>::construct()
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {   ///< UT Justified Branch: HW dependency
+            break;
+        }
+        if( !initialize() )
+        {
+            break;
+        }
+        res = true;
+    } while(false);
+    return res;
+}
+
+template <class A>
+bool_t EventGroupResource<A>::initialize()
+{
+    group_ = ::xEventGroupCreateStatic( &buffer_ );
+    return group_ != NULL;
+}
+
+template <class A>
+void EventGroupResource<A>::deinitialize()
+{
+    if( group_ != NULL )
+    {
+        ::vEventGroupDelete( group_ );
+        group_ = NULL;
+    }
+}
+
+template <class A>
+uint32_t EventGroupResource<A>::wait(uint32_t bits, bool_t isClear, bool_t isAll, ::TickType_t ticks)
+{
+    uint32_t res( 0 );
+    if( isConstructed() && isBits(bits) && (bits != 0) )
+    {
+        ::BaseType_t const xClearOnExit( isClear ? pdTRUE : pdFALSE );
+        ::BaseType_t const xWaitForAllBits( isAll ? pdTRUE : pdFALSE );
+        ::EventBits_t const uxBits( ::xEventGroupWaitBits(group_, static_cast<::EventBits_t>(bits), xClearOnExit, xWaitForAllBits, ticks) );
+        res = static_cast<uint32_t>(uxBits);
+    }
+    return res;
+}
+
+template <class A>
+bool_t EventGroupResource<A>::isBits(uint32_t bits)
+{
+    return (bits & ~BITS_MASK) == 0;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_EVENTGROUPRESOURCE_HPP_
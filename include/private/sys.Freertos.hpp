@@ -10,7 +10,10 @@
 
 #include "FreeRTOS.h"
 #include "task.h"
+#include "queue.h"
 #include "semphr.h"
+#include "timers.h"
+#include "event_groups.h"
 #include "port.Kernel.hpp"
 
 #endif // SYS_FREERTOS_HPP_
@@ -0,0 +1,296 @@
+/**
+ * @file      sys.FutureResource.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_FUTURERESOURCE_HPP_
+#define SYS_FUTURERESOURCE_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.TimeMap.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class FutureResource
+ * @brief Shared state of a promise and its future.
+ *
+ * A result is set once by a producer thread or interrupt, and got by one
+ * consumer thread. The consumer waits for the result on its FreeRTOS task
+ * notification, thus the state needs no kernel objects.
+ *
+ * @note The result is copied in a critical section, so it should be small.
+ *
+ * @tparam T Type of the result, which has to be default constructible and copyable.
+ * @tparam A Heap memory allocator class.
+ */
+template <typename T, class A>
+class FutureResource : public NonCopyable<A>
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    FutureResource();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~FutureResource();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Sets the result and wakes up the waiting consumer.
+     *
+     * @param value A result.
+     * @return True if the result is set, or false if it has been already set.
+     */
+    bool_t set(T const& value);
+
+    /**
+     * @brief Sets the result from interrupt service routine.
+     *
+     * @param value A result.
+     * @return True if the result is set, or false if it has been already set.
+     */
+    bool_t setFromInterrupt(T const& value);
+
+    /**
+     * @brief Test if the contex has to be switched.
+     *
+     * @return True to switch contex.
+     */
+    bool_t hasToSwitchContex() const;
+
+    /**
+     * @brief Waits for the result.
+     *
+     * @param value A variable for the result.
+     * @return True if the result is got.
+     */
+    bool_t get(T& value);
+
+    /**
+     * @brief Waits for the result for a time.
+     *
+     * @param value A variable for the result.
+     * @param ms    A time to wait in milliseconds.
+     * @return True if the result is got.
+     */
+    bool_t get(T& value, int32_t ms);
+
+    /**
+     * @brief Tests if the result is set.
+     *
+     * @return True if the result is set.
+     */
+    bool_t isReady() const;
+
+    /**
+     * @brief Clears the result to reuse this state for a new result.
+     */
+    void reset();
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Waits for the result for a number of ticks.
+     *
+     * @param value A variable for the result.
+     * @param ticks A number of ticks to wait, or portMAX_DELAY.
+     * @return True if the result is got.
+     */
+    bool_t getFor(T& value, ::TickType_t ticks);
+
+    /**
+     * @brief The result.
+     */
+    T value_;
+
+    /**
+     * @brief The result is set flag.
+     */
+    bool_t isReady_;
+
+    /**
+     * @brief The waiting consumer task.
+     */
+    ::TaskHandle_t waiter_;
+
+    /**
+     * @brief Higher priority task woken flag.
+     */
+    ::BaseType_t xHigherPriorityTaskWoken_;
+
+};
+
+template <typename T, class A>
+FutureResource<T,A>::FutureResource()
+    : NonCopyable<A>()
+    , value_()
+    , isReady_( false )
+    , waiter_( NULL )
+    , xHigherPriorityTaskWoken_( pdFALSE ) {
+}
+
+template <typename T, class A>
+FutureResource<T,A>::~FutureResource()
+{
+}
+
+template <typename T, class A>
+bool_t FutureResource<T,A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <typename T, class A>
+bool_t FutureResource<T,A>::set(T const& value)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        ::TaskHandle_t waiter( NULL );
+        taskENTER_CRITICAL();
+        if( !isReady_ )
+        {
+            value_ = value;
+            isReady_ = true;
+            waiter = waiter_;
+            res = true;
+        }
+        taskEXIT_CRITICAL();
+        if( waiter != NULL )
+        {
+            static_cast<void>( ::xTaskNotifyGive(waiter) );
+        }
+    }
+    return res;
+}
+
+template <typename T, class A>
+bool_t FutureResource<T,A>::setFromInterrupt(T const& value)
+{
+    bool_t res( false );
+    xHigherPriorityTaskWoken_ = pdFALSE;
+    if( isConstructed() )
+    {
+        ::TaskHandle_t waiter( NULL );
+        ::UBaseType_t const mask( taskENTER_CRITICAL_FROM_ISR() );
+        if( !isReady_ )
+        {
+            value_ = value;
+            isReady_ = true;
+            waiter = waiter_;
+            res = true;
+        }
+        taskEXIT_CRITICAL_FROM_ISR(mask);
+        if( waiter != NULL )
+        {
+            ::vTaskNotifyGiveFromISR(waiter, &xHigherPriorityTaskWoken_);
+        }
+    }
+    return res;
+}
+
+template <typename T, class A>
+bool_t FutureResource<T,A>::hasToSwitchContex() const
+{
+    return xHigherPriorityTaskWoken_ != pdFALSE;
+}
+
+template <typename T, class A>
+bool_t FutureResource<T,A>::get(T& value)
+{
+    return getFor(value, portMAX_DELAY);
+}
+
+template <typename T, class A>
+bool_t FutureResource<T,A>::get(T& value, int32_t ms)
+{
+    bool_t res( false );
+    if( ms >= 0 )
+    {
+        res = getFor(value, TimeMap::toTicks(ms));
+    }
+    return res;
+}
+
+template <typename T, class A>
+bool_t FutureResource<T,A>::isReady() const
+{
+    return isConstructed() && isReady_;
+}
+
+template <typename T, class A>
+void FutureResource<T,A>::reset()
+{
+    taskENTER_CRITICAL();
+    isReady_ = false;
+    waiter_ = NULL;
+    taskEXIT_CRITICAL();
+}
+
+template <typename T, class A>
+bool_t FutureResource<T,A>::getFor(T& value, ::TickType_t ticks)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        ::TickType_t const start( ::xTaskGetTickCount() );
+        while( true )
+        {
+            taskENTER_CRITICAL();
+            if( isReady_ )
+            {
+                value = value_;
+                waiter_ = NULL;
+                res = true;
+            }
+            else
+            {
+                waiter_ = ::xTaskGetCurrentTaskHandle();
+            }
+            taskEXIT_CRITICAL();
+            if( res )
+            {
+                break;
+            }
+            ::TickType_t timeout( portMAX_DELAY );
+            if( ticks != portMAX_DELAY )
+            {
+                ::TickType_t const elapsed( ::xTaskGetTickCount() - start );
+                if( elapsed >= ticks )
+                {
+                    taskENTER_CRITICAL();
+                    waiter_ = NULL;
+                    taskEXIT_CRITICAL();
+                    break;
+                }
+                timeout = ticks - elapsed;
+            }
+            // A notification given by other code wakes the task up spuriously,
+            // thus the result flag is tested again
+            static_cast<void>( ::ulTaskNotifyTake(pdTRUE, timeout) );
+        }
+    }
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_FUTURERESOURCE_HPP_
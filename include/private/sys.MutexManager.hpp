@@ -7,8 +7,10 @@
 #define SYS_MUTEXMANAGER_HPP_
 
 #include "sys.NonCopyable.hpp"
+#include "sys.Configuration.hpp"
 #include "api.MutexManager.hpp"
 #include "sys.Mutex.hpp"
+#include "sys.RwLockResource.hpp"
 #include "lib.ResourceMemory.hpp"
 
 namespace eoos
@@ -27,6 +29,37 @@ class MutexManager : public NonCopyable<NoAllocator>, public api::MutexManager
 
 public:
 
+    /**
+     * @class RwLockAllocator
+     * @brief Reader-writer lock memory allocator.
+     */
+    class RwLockAllocator
+    {
+
+    public:
+
+        /**
+         * @brief Allocates memory.
+         *
+         * @param size Number of bytes to allocate.
+         * @return Allocated memory address or a null pointer.
+         */
+        static void* allocate(size_t size);
+
+        /**
+         * @brief Frees allocated memory.
+         *
+         * @param ptr Address of allocated memory block or a null pointer.
+         */
+        static void free(void* ptr);
+
+    };
+
+    /**
+     * @brief Reader-writer lock resource type.
+     */
+    typedef RwLockResource<RwLockAllocator> RwLock;
+
     /**
      * @brief Constructor.
      */
@@ -47,6 +80,13 @@ public:
      */
     virtual api::Mutex* create();
 
+    /**
+     * @brief Creates a new reader-writer lock resource.
+     *
+     * @return A new reader-writer lock resource, or NULLPTR if an error has been occurred.
+     */
+    RwLock* createRwLock();
+
     /**
      * @brief Allocates memory.
      *
@@ -78,10 +118,11 @@ private:
     /**
      * @brief Initializes the allocator with heap for resource allocation.
      *
-     * @param resource Heap for resource allocation.
+     * @param resource       Heap for mutex resource allocation.
+     * @param rwLockResource Heap for reader-writer lock resource allocation.
      * @return True if initialized.
      */
-    static bool_t initialize(api::Heap* resource);
+    static bool_t initialize(api::Heap* resource, api::Heap* rwLockResource);
 
     /**
      * @brief Initializes the allocator.
@@ -114,7 +155,12 @@ private:
         /**
          * @brief Mutex memory allocator.
          */     
-        lib::ResourceMemory<Resource, EOOS_GLOBAL_SYS_NUMBER_OF_MUTEXS> memory;
+        lib::ResourceMemory<Resource, Configuration::NUMBER_OF_MUTEXS> memory;
+
+        /**
+         * @brief Reader-writer lock memory allocator.
+         */
+        lib::ResourceMemory<RwLock, Configuration::NUMBER_OF_RWLOCKS> rwLockMemory;
 
     };
 
@@ -122,6 +168,11 @@ private:
      * @brief Heap for resource allocation.
      */
     static api::Heap* resource_;
+
+    /**
+     * @brief Heap for reader-writer lock resource allocation.
+     */
+    static api::Heap* rwLockResource_;
         
     /**
      * @brief Resource memory pool.
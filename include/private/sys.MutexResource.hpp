@@ -8,6 +8,7 @@
 
 #include "sys.NonCopyable.hpp"
 #include "api.Mutex.hpp"
+#include "sys.MutexTrace.hpp"
 
 namespace eoos
 {
@@ -87,6 +88,25 @@ private:
      */
     ::SemaphoreHandle_t mutex_;
 
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_MUTEX_TRACE
+
+    /**
+     * @brief Contention statistics record.
+     */
+    MutexTrace::Record* trace_;
+
+    /**
+     * @brief Number of recursive locks by the owner thread.
+     */
+    int32_t depth_;
+
+    /**
+     * @brief Time the owner thread acquired this mutex.
+     */
+    uint32_t time_;
+
+    #endif // EOOS_GLOBAL_SYS_ENABLE_MUTEX_TRACE
+
     /**
      * @brief Mutex FreeRTOS statatic buffer.
      */    
@@ -99,6 +119,11 @@ MutexResource<A>::MutexResource()
     : NonCopyable<A>()
     , api::Mutex()
     , mutex_()
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_MUTEX_TRACE
+    , trace_( NULLPTR )
+    , depth_( 0 )
+    , time_( 0 )
+    #endif // EOOS_GLOBAL_SYS_ENABLE_MUTEX_TRACE
     , buffer_() {
     bool_t const isConstructed( construct() );
     setConstructed( isConstructed );
@@ -128,7 +153,27 @@ bool_t MutexResource<A>::lock()
     bool_t res( false );
     if( isConstructed() )
     {
+        #ifdef EOOS_GLOBAL_SYS_ENABLE_MUTEX_TRACE
+        uint32_t const begin( MutexTrace::getTime() );
+        ::BaseType_t isTaken( ::xSemaphoreTakeRecursive(mutex_, 0) );
+        bool_t const isContended( isTaken != pdPASS );
+        if( isContended )
+        {
+            MutexTrace::contend( trace_, ::xSemaphoreGetMutexHolder(mutex_) );
+            isTaken = ::xSemaphoreTakeRecursive(mutex_, portMAX_DELAY);
+        }
+        if( isTaken == pdPASS )
+        {
+            MutexTrace::acquire(trace_, begin, isContended);
+            if( depth_ == 0 )
+            {
+                time_ = MutexTrace::getTime();
+            }
+            depth_++;
+        }
+        #else
         ::BaseType_t const isTaken( ::xSemaphoreTakeRecursive(mutex_, portMAX_DELAY) );
+        #endif // EOOS_GLOBAL_SYS_ENABLE_MUTEX_TRACE
         res = (isTaken == pdPASS) ? true : false;
     }
     return res;
@@ -140,6 +185,19 @@ bool_t MutexResource<A>::unlock()
     bool_t res( false );
     if( isConstructed() )
     {
+        #ifdef EOOS_GLOBAL_SYS_ENABLE_MUTEX_TRACE
+        // Only the owner thread can decrement the depth as giving by other threads fails
+        bool_t const isOwner( ::xSemaphoreGetMutexHolder(mutex_) == ::xTaskGetCurrentTaskHandle() );
+        uint32_t const begin( time_ );
+        if( isOwner && (depth_ > 0) )
+        {
+            depth_--;
+            if( depth_ == 0 )
+            {
+                MutexTrace::release(trace_, begin);
+            }
+        }
+        #endif // EOOS_GLOBAL_SYS_ENABLE_MUTEX_TRACE
         ::BaseType_t const isGiven( ::xSemaphoreGiveRecursive(mutex_) );
         res = (isGiven == pdPASS) ? true : false;
     }
@@ -170,6 +228,12 @@ bool_t MutexResource<A>::initialize()
 {
     
     mutex_ = ::xSemaphoreCreateRecursiveMutexStatic( &buffer_ );
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_MUTEX_TRACE
+    if( mutex_ != NULL )
+    {
+        trace_ = MutexTrace::allocate(mutex_);
+    }
+    #endif // EOOS_GLOBAL_SYS_ENABLE_MUTEX_TRACE
     return mutex_ != NULL;
 }
 
@@ -178,6 +242,10 @@ void MutexResource<A>::deinitialize()
 {
     if( mutex_ != NULL )
     {
+        #ifdef EOOS_GLOBAL_SYS_ENABLE_MUTEX_TRACE
+        MutexTrace::free(trace_);
+        trace_ = NULLPTR;
+        #endif // EOOS_GLOBAL_SYS_ENABLE_MUTEX_TRACE
         ::vSemaphoreDelete( mutex_ );
     }
 }
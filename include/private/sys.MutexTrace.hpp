@@ -0,0 +1,171 @@
+/**
+ * @file      sys.MutexTrace.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_MUTEXTRACE_HPP_
+#define SYS_MUTEXTRACE_HPP_
+
+#include "sys.Configuration.hpp"
+
+#ifdef EOOS_GLOBAL_SYS_ENABLE_MUTEX_TRACE
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class MutexTrace
+ * @brief Mutex contention statistics.
+ *
+ * Each mutex takes one record of a fixed-size table while it exists. Times are
+ * measured by the run time statistics counter if the kernel generates it,
+ * otherwise in the kernel ticks.
+ */
+class MutexTrace
+{
+
+public:
+
+    /**
+     * @struct Record
+     * @brief Contention statistics of one mutex.
+     */
+    struct Record
+    {
+        /**
+         * @brief The traced kernel mutex or NULL if the record is free.
+         */
+        void const* mutex;
+
+        /**
+         * @brief Number of successful locks including recursive ones.
+         */
+        uint32_t locks;
+
+        /**
+         * @brief Number of locks which found the mutex held by another thread.
+         */
+        uint32_t contentions;
+
+        /**
+         * @brief Number of contentions when the holder had a lower priority than the contender.
+         *
+         * @note On each such contention the kernel raises the holder priority.
+         */
+        uint32_t inheritances;
+
+        /**
+         * @brief Number of threads currently waiting for the mutex.
+         */
+        uint32_t contenders;
+
+        /**
+         * @brief Maximum number of threads waited for the mutex at once.
+         */
+        uint32_t maxContenders;
+
+        /**
+         * @brief Total time threads waited for the mutex.
+         */
+        uint32_t waitTotal;
+
+        /**
+         * @brief Maximum time a thread waited for the mutex.
+         */
+        uint32_t waitMax;
+
+        /**
+         * @brief Total time the mutex was held.
+         */
+        uint32_t holdTotal;
+
+        /**
+         * @brief Maximum time the mutex was held.
+         */
+        uint32_t holdMax;
+    };
+
+    /**
+     * @brief Takes a free record for a mutex.
+     *
+     * @param mutex A kernel mutex.
+     * @return A record, or NULLPTR if no free records.
+     */
+    static Record* allocate(void const* mutex);
+
+    /**
+     * @brief Returns a record to the table.
+     *
+     * @param record A record or NULLPTR.
+     */
+    static void free(Record* record);
+
+    /**
+     * @brief Records a thread found a mutex held by another thread.
+     *
+     * @param record A record or NULLPTR.
+     * @param holder The thread which holds the mutex.
+     */
+    static void contend(Record* record, ::TaskHandle_t holder);
+
+    /**
+     * @brief Records a thread acquired a mutex.
+     *
+     * @param record      A record or NULLPTR.
+     * @param begin       Time the thread has started to lock the mutex.
+     * @param isContended The thread found the mutex held by another thread.
+     */
+    static void acquire(Record* record, uint32_t begin, bool_t isContended);
+
+    /**
+     * @brief Records a thread released a mutex.
+     *
+     * @param record A record or NULLPTR.
+     * @param begin  Time the mutex was acquired.
+     */
+    static void release(Record* record, uint32_t begin);
+
+    /**
+     * @brief Copies a record of the table.
+     *
+     * @param index  An index of the record.
+     * @param record A record to copy to.
+     * @return True if the record exists and is used by a mutex.
+     */
+    static bool_t getRecord(int32_t index, Record& record);
+
+    /**
+     * @brief Returns number of records in the table.
+     *
+     * @return Number of records.
+     */
+    static int32_t getNumberOfRecords();
+
+    /**
+     * @brief Returns current time.
+     *
+     * @return Time in the run time counter units or the kernel ticks.
+     */
+    static uint32_t getTime();
+
+private:
+
+    /**
+     * @brief Number of records.
+     */
+    static const int32_t NUMBER_OF_RECORDS = Configuration::NUMBER_OF_MUTEX_TRACES;
+
+    /**
+     * @brief The records table.
+     */
+    static Record records_[NUMBER_OF_RECORDS];
+
+};
+
+} // namespace sys
+} // namespace eoos
+
+#endif // EOOS_GLOBAL_SYS_ENABLE_MUTEX_TRACE
+#endif // SYS_MUTEXTRACE_HPP_
@@ -0,0 +1,87 @@
+/**
+ * @file      sys.PriorityMap.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_PRIORITYMAP_HPP_
+#define SYS_PRIORITYMAP_HPP_
+
+#include "sys.Configuration.hpp"
+#include "api.Thread.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class PriorityMap
+ * @brief Map of EOOS thread priorities to FreeRTOS task priorities.
+ *
+ * The idle priority is mapped to tskIDLE_PRIORITY. The other EOOS levels are
+ * mapped to FreeRTOS priorities by the EOOS_GLOBAL_SYS_PRIORITY_MAP table,
+ * or linearly spread over 1 to configMAX_PRIORITIES - 1 if the table is not defined.
+ */
+class PriorityMap
+{
+
+public:
+
+    /**
+     * @brief Tests if an EOOS priority is valid.
+     *
+     * @param priority An EOOS priority.
+     * @return True if valid.
+     */
+    static bool_t isPriority(int32_t priority);
+
+    /**
+     * @brief Converts a valid EOOS priority to a FreeRTOS priority.
+     *
+     * @param priority An EOOS priority.
+     * @return A FreeRTOS priority.
+     */
+    static ::UBaseType_t toKernel(int32_t priority);
+
+    /**
+     * @brief Converts a FreeRTOS priority to an EOOS priority.
+     *
+     * A FreeRTOS priority between two mapped priorities is converted to
+     * the lower EOOS level, and a FreeRTOS priority several EOOS levels are
+     * mapped to is converted to the highest of these levels.
+     *
+     * @param priority A FreeRTOS priority.
+     * @return An EOOS priority.
+     */
+    static int32_t toEoos(::UBaseType_t priority);
+
+    /**
+     * @brief Tests if the map is valid.
+     *
+     * All mapped FreeRTOS priorities have to be less than configMAX_PRIORITIES,
+     * and do not decrease with EOOS levels.
+     *
+     * @return True if valid.
+     */
+    static bool_t isValid();
+
+private:
+
+    /**
+     * @brief Number of EOOS priority levels including the idle level.
+     */
+    static const int32_t NUMBER_OF_LEVELS = api::Thread::PRIORITY_MAX + 1;
+
+    /**
+     * @brief FreeRTOS priorities indexed by EOOS priorities.
+     */
+    static const ::UBaseType_t MAP[NUMBER_OF_LEVELS];
+
+};
+
+EOOS_SYS_STATIC_ASSERT(api::Thread::PRIORITY_IDLE == 0, "EOOS idle priority is expected to be zero");
+EOOS_SYS_STATIC_ASSERT(configMAX_PRIORITIES >= 2, "configMAX_PRIORITIES shall have a level above the idle task");
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_PRIORITYMAP_HPP_
@@ -0,0 +1,349 @@
+/**
+ * @file      sys.RealTimeManager.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_REALTIMEMANAGER_HPP_
+#define SYS_REALTIMEMANAGER_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.Mutex.hpp"
+#include "api.Runnable.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+class Scheduler;
+
+/**
+ * @class RealTimeManager
+ * @brief Rate-monotonic admission control of periodic threads.
+ *
+ * A periodic thread declares its period, worst-case execution time and
+ * deadline, and asks for admission. The manager admits the thread only if
+ * response-time analysis proves the whole set of admitted threads meets
+ * their deadlines, and assigns FreeRTOS priorities to the set by deadlines,
+ * which is rate-monotonic if the deadlines equal the periods. The priorities
+ * are taken from the band above the EOOS normal priority. An admitted EOOS
+ * thread reports the assigned priority, and keeps it until withdrawn.
+ *
+ * The manager checks deadlines on each system tick, counts misses, and
+ * executes an alarm routine by the timer daemon task if a deadline is missed.
+ */
+class RealTimeManager : public NonCopyable<NoAllocator>, public api::Runnable
+{
+    typedef NonCopyable<NoAllocator> Parent;
+
+public:
+
+    /**
+     * @class Periodic
+     * @brief Periodic activity of a thread.
+     */
+    class Periodic : public NonCopyable<NoAllocator>
+    {
+        typedef NonCopyable<NoAllocator> Parent;
+
+        friend class RealTimeManager;
+
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param period   A period in milliseconds.
+         * @param wcet     A worst-case execution time of one job in milliseconds.
+         * @param deadline A relative deadline in milliseconds not greater than the period.
+         */
+        Periodic(int32_t period, int32_t wcet, int32_t deadline);
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~Periodic();
+
+        /**
+         * @copydoc eoos::api::Object::isConstructed()
+         */
+        virtual bool_t isConstructed() const;
+
+        /**
+         * @brief Completes the current job, and waits for the next release.
+         *
+         * @return True if the next job is released.
+         */
+        bool_t wait();
+
+        /**
+         * @brief Tests if the activity is admitted.
+         *
+         * @return True if admitted.
+         */
+        bool_t isAdmitted() const;
+
+        /**
+         * @brief Returns number of missed deadlines.
+         *
+         * @return Number of misses.
+         */
+        uint32_t getMisses() const;
+
+        /**
+         * @brief Returns the worst-case response time given by the analysis.
+         *
+         * @return The response time in ticks.
+         */
+        ::TickType_t getResponseTime() const;
+
+        /**
+         * @brief Returns the maximum measured response time.
+         *
+         * @return The response time in ticks.
+         */
+        ::TickType_t getResponseTimeMax() const;
+
+    protected:
+
+        using Parent::setConstructed;
+
+    private:
+
+        /**
+         * @brief Period in ticks.
+         */
+        ::TickType_t period_;
+
+        /**
+         * @brief Worst-case execution time in ticks.
+         */
+        ::TickType_t wcet_;
+
+        /**
+         * @brief Relative deadline in ticks.
+         */
+        ::TickType_t deadline_;
+
+        /**
+         * @brief Worst-case response time in ticks.
+         */
+        ::TickType_t response_;
+
+        /**
+         * @brief Maximum measured response time in ticks.
+         */
+        ::TickType_t responseMax_;
+
+        /**
+         * @brief Release time of the current job.
+         */
+        ::TickType_t release_;
+
+        /**
+         * @brief Release time of the next job given to the kernel delay.
+         */
+        ::TickType_t wake_;
+
+        /**
+         * @brief The thread FreeRTOS task.
+         */
+        ::TaskHandle_t task_;
+
+        /**
+         * @brief FreeRTOS priority of a task which is not an EOOS thread before admission.
+         */
+        ::UBaseType_t priority_;
+
+        /**
+         * @brief The current job is done flag.
+         */
+        bool_t isDone_;
+
+        /**
+         * @brief The current job deadline is missed flag.
+         */
+        bool_t isMissed_;
+
+        /**
+         * @brief Number of missed deadlines.
+         */
+        uint32_t misses_;
+
+        /**
+         * @brief The manager which admitted the activity.
+         */
+        RealTimeManager* manager_;
+
+        /**
+         * @brief Next activity of a lower priority.
+         */
+        Periodic* next_;
+
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @param scheduler The operating system scheduler.
+     */
+    RealTimeManager(Scheduler& scheduler);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~RealTimeManager();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Checks deadlines on the system tick.
+     */
+    virtual void start();
+
+    /**
+     * @brief Admits a periodic activity of the calling thread.
+     *
+     * The first job of the activity is released on the call.
+     *
+     * @param periodic A periodic activity.
+     * @return True if the set of activities stays schedulable, and the activity is admitted.
+     */
+    bool_t admit(Periodic& periodic);
+
+    /**
+     * @brief Withdraws an admitted activity.
+     *
+     * @param periodic A periodic activity.
+     * @return True if the activity is withdrawn.
+     */
+    bool_t withdraw(Periodic& periodic);
+
+    /**
+     * @brief Sets a routine called by the timer daemon task if a deadline is missed.
+     *
+     * @param alarm A routine, or NULLPTR to remove the routine.
+     */
+    void setAlarm(api::Runnable* alarm);
+
+    /**
+     * @brief Returns number of missed deadlines of all activities.
+     *
+     * @return Number of misses.
+     */
+    uint32_t getMisses() const;
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @param scheduler The operating system scheduler.
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct(Scheduler& scheduler);
+
+    /**
+     * @brief Hooks this manager to the system tick if it is not hooked yet.
+     *
+     * @return True if the manager is hooked.
+     */
+    bool_t activate();
+
+    /**
+     * @brief Calculates worst-case response times of a list of activities.
+     *
+     * @param head The highest priority activity.
+     * @return True if all activities meet their deadlines.
+     */
+    static bool_t analyse(Periodic* head);
+
+    /**
+     * @brief Links an activity to the list by its deadline.
+     *
+     * @param periodic A periodic activity.
+     */
+    void link(Periodic& periodic);
+
+    /**
+     * @brief Unlinks an activity from the list.
+     *
+     * @param periodic A periodic activity.
+     */
+    void unlink(Periodic& periodic);
+
+    /**
+     * @brief Assigns FreeRTOS priorities to the admitted activities.
+     */
+    void assign();
+
+    /**
+     * @brief Calls the alarm routine.
+     */
+    void alarm();
+
+    /**
+     * @brief Calls the alarm routine by the timer daemon.
+     *
+     * @param pvParameter1 The manager.
+     * @param ulParameter2 Unused.
+     */
+    static void alarm(void* pvParameter1, uint32_t ulParameter2);
+
+    /**
+     * @brief The operating system scheduler.
+     */
+    Scheduler& scheduler_;
+
+    /**
+     * @brief The highest FreeRTOS priority of the activities.
+     */
+    ::UBaseType_t priorityMax_;
+
+    /**
+     * @brief FreeRTOS priority below all the activities.
+     */
+    ::UBaseType_t priorityMin_;
+
+    /**
+     * @brief Mutex of admission.
+     */
+    Mutex mutex_;
+
+    /**
+     * @brief Admitted activities from the highest priority.
+     */
+    Periodic* head_;
+
+    /**
+     * @brief Alarm routine.
+     */
+    api::Runnable* alarm_;
+
+    /**
+     * @brief Number of missed deadlines.
+     */
+    uint32_t misses_;
+
+    /**
+     * @brief The alarm is pended to the timer daemon flag.
+     */
+    bool_t isPended_;
+
+    /**
+     * @brief This manager is hooked to the system tick flag.
+     */
+    bool_t isActive_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_REALTIMEMANAGER_HPP_
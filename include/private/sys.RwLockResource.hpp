@@ -0,0 +1,278 @@
+/**
+ * @file      sys.RwLockResource.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_RWLOCKRESOURCE_HPP_
+#define SYS_RWLOCKRESOURCE_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.Mutex.hpp"
+#include "sys.ConditionVariable.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class RwLockResource
+ * @brief Reader-writer lock resource class with writer preference.
+ *
+ * Any number of readers can hold the lock at the same time, while a writer holds
+ * it exclusively. New readers are blocked as soon as a writer is waiting, and
+ * a released lock is handed to a waiting writer first. The kernel wakes up
+ * the waiting writer with the highest priority.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class RwLockResource : public NonCopyable<A>
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    RwLockResource();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~RwLockResource();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Locks for reading.
+     *
+     * @return True if the lock is acquired.
+     */
+    bool_t readLock();
+
+    /**
+     * @brief Unlocks after reading.
+     *
+     * @return True if the lock is released.
+     */
+    bool_t readUnlock();
+
+    /**
+     * @brief Locks for writing.
+     *
+     * @return True if the lock is acquired.
+     */
+    bool_t writeLock();
+
+    /**
+     * @brief Unlocks after writing.
+     *
+     * @return True if the lock is released.
+     */
+    bool_t writeUnlock();
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Mutex of the lock state.
+     */
+    Mutex mutex_;
+
+    /**
+     * @brief Condition of readers.
+     */
+    ConditionVariable readCondition_;
+
+    /**
+     * @brief Condition of writers.
+     */
+    ConditionVariable writeCondition_;
+
+    /**
+     * @brief Number of readers holding the lock.
+     */
+    int32_t readers_;
+
+    /**
+     * @brief Number of writers waiting for the lock.
+     */
+    int32_t writers_;
+
+    /**
+     * @brief A writer holds the lock.
+     */
+    bool_t isWriting_;
+
+};
+
+template <class A>
+RwLockResource<A>::RwLockResource()
+    : NonCopyable<A>()
+    , mutex_()
+    , readCondition_()
+    , writeCondition_()
+    , readers_( 0 )
+    , writers_( 0 )
+    , isWriting_( false ) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+RwLockResource<A>::~RwLockResource()
+{
+}
+
+template <class A>
+bool_t RwLockResource<A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t RwLockResource<A>::readLock()
+{
+    bool_t res( false );
+    if( isConstructed() && mutex_.lock() )
+    {
+        res = true;
+        while( isWriting_ || (writers_ > 0) )
+        {
+            if( !readCondition_.wait(mutex_) )
+            {
+                res = false;
+                break;
+            }
+        }
+        if( res )
+        {
+            readers_++;
+        }
+        static_cast<void>( mutex_.unlock() );
+    }
+    return res;
+}
+
+template <class A>
+bool_t RwLockResource<A>::readUnlock()
+{
+    bool_t res( false );
+    if( isConstructed() && mutex_.lock() )
+    {
+        if( readers_ > 0 )
+        {
+            readers_--;
+            if( (readers_ == 0) && (writers_ > 0) )
+            {
+                static_cast<void>( writeCondition_.notifyOne() );
+            }
+            res = true;
+        }
+        static_cast<void>( mutex_.unlock() );
+    }
+    return res;
+}
+
+template <class A>
+bool_t RwLockResource<A>::writeLock()
+{
+    bool_t res( false );
+    if( isConstructed() && mutex_.lock() )
+    {
+        res = true;
+        writers_++;
+        while( isWriting_ || (readers_ > 0) )
+        {
+            if( !writeCondition_.wait(mutex_) )
+            {
+                res = false;
+                break;
+            }
+        }
+        writers_--;
+        if( res )
+        {
+            isWriting_ = true;
+        }
+        else if( (writers_ == 0) && !isWriting_ )
+        {
+            static_cast<void>( readCondition_.notifyAll() );
+        }
+        else
+        {
+        }
+        static_cast<void>( mutex_.unlock() );
+    }
+    return res;
+}
+
+template <class A>
+bool_t RwLockResource<A>::writeUnlock()
+{
+    bool_t res( false );
+    if( isConstructed() && mutex_.lock() )
+    {
+        if( isWriting_ )
+        {
+            isWriting_ = false;
+            if( writers_ > 0 )
+            {
+                static_cast<void>( writeCondition_.notifyOne() );
+            }
+            else
+            {
+                static_cast<void>( readCondition_.notifyAll() );
+            }
+            res = true;
+        }
+        static_cast<void>( mutex_.unlock() );
+    }
+    return res;
+}
+
+template <class A>
+bool_t RwLockResource<A>::construct()
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {   ///< UT Justified Branch: HW dependency
+            break;
+        }
+        if( !mutex_.isConstructed() )
+        {
+            break;
+        }
+        if( !readCondition_.isConstructed() )
+        {
+            break;
+        }
+        if( !writeCondition_.isConstructed() )
+        {
+            break;
+        }
+        res = true;
+    } while(false);
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_RWLOCKRESOURCE_HPP_
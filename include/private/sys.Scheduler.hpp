@@ -7,6 +7,7 @@
 #define SYS_SCHEDULER_HPP_
 
 #include "sys.NonCopyable.hpp"
+#include "sys.Configuration.hpp"
 #include "api.Scheduler.hpp"
 #include "api.CpuProcessor.hpp"
 #include "sys.ThreadResource.hpp"
@@ -52,6 +53,33 @@ public:
      * @copydoc eoos::api::Scheduler::createThread(api::Task&)
      */     
     virtual api::Thread* createThread(api::Task& task);
+
+    /**
+     * @brief Creates a new named thread.
+     *
+     * @param task A task interface whose main method is invoked when the thread is started.
+     * @param name A name of the thread for debug purposes.
+     * @return New thread resource, or NULLPTR if an error has been occurred.
+     */
+    api::Thread* createThread(api::Task& task, char_t const* name);
+
+    /**
+     * @brief Creates and executes a detached thread.
+     *
+     * The thread is deleted, and its pool memory is reclaimed, after the task routine returns.
+     *
+     * @param task A task interface whose main method is invoked when the thread is started.
+     * @param name A name of the thread for debug purposes.
+     * @return True if the thread is executed.
+     */
+    bool_t executeDetachedThread(api::Task& task, char_t const* name);
+
+    /**
+     * @brief Returns the currently running thread.
+     *
+     * @return The thread, or NULLPTR if the caller is not an EOOS thread.
+     */
+    api::Thread* getCurrentThread();
     
     /**
      * @copydoc eoos::api::Scheduler::sleep(int32_t)
@@ -62,6 +90,24 @@ public:
      * @copydoc eoos::api::Scheduler::yield()
      */
     virtual bool_t yield();
+
+    /**
+     * @brief Adds a routine called on each system tick.
+     *
+     * @note The routine is called in the interrupt context.
+     *
+     * @param hook A routine to be called.
+     * @return True if the routine has been added.
+     */
+    bool_t addTickHook(api::Runnable& hook);
+
+    /**
+     * @brief Removes a routine called on each system tick.
+     *
+     * @param hook A routine to be removed.
+     * @return True if the routine has been removed.
+     */
+    bool_t removeTickHook(api::Runnable& hook);
     
     /**
      * @brief Allocates memory.
@@ -173,7 +219,7 @@ private:
         /**
          * @brief Resource memory allocator.
          */     
-        lib::ResourceMemory<Resource, EOOS_GLOBAL_SYS_NUMBER_OF_THREADS> memory;
+        lib::ResourceMemory<Resource, Configuration::NUMBER_OF_THREADS> memory;
 
     };
 
@@ -7,6 +7,7 @@
 #define SYS_SCHEDULERROUTINETIMER_HPP_
 
 #include "sys.NonCopyable.hpp"
+#include "sys.Configuration.hpp"
 #include "api.Runnable.hpp"
 
 namespace eoos
@@ -44,6 +45,24 @@ public:
      */
     virtual void start();
 
+    /**
+     * @brief Adds a routine called on each system tick.
+     *
+     * @note The routine is called in the interrupt context.
+     *
+     * @param hook A routine to be called.
+     * @return True if the routine has been added.
+     */
+    bool_t addHook(api::Runnable& hook);
+
+    /**
+     * @brief Removes a routine called on each system tick.
+     *
+     * @param hook A routine to be removed.
+     * @return True if the routine has been removed.
+     */
+    bool_t removeHook(api::Runnable& hook);
+
 private:
 
     /**
@@ -53,6 +72,16 @@ private:
      */
     bool_t construct();
 
+    /**
+     * @brief Number of tick hooks.
+     */
+    static const int32_t NUMBER_OF_HOOKS = Configuration::NUMBER_OF_TICK_HOOKS;
+
+    /**
+     * @brief Routines called on each system tick.
+     */
+    api::Runnable* hooks_[NUMBER_OF_HOOKS];
+
 };
 
 } // namespace sys
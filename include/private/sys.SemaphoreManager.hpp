@@ -7,6 +7,7 @@
 #define SYS_SEMAPHOREMANAGER_HPP_
 
 #include "sys.NonCopyable.hpp"
+#include "sys.Configuration.hpp"
 #include "api.SemaphoreManager.hpp"
 #include "sys.Semaphore.hpp"
 #include "sys.Mutex.hpp"
@@ -115,7 +116,7 @@ private:
         /**
          * @brief Semaphore memory allocator.
          */     
-        lib::ResourceMemory<Resource, EOOS_GLOBAL_SYS_NUMBER_OF_SEMAPHORES> memory;
+        lib::ResourceMemory<Resource, Configuration::NUMBER_OF_SEMAPHORES> memory;
 
     };    
 
@@ -8,6 +8,7 @@
 
 #include "sys.NonCopyable.hpp"
 #include "api.Semaphore.hpp"
+#include "sys.TraceRecorder.hpp"
 
 namespace eoos
 {
@@ -233,6 +234,9 @@ bool_t SemaphoreResource<A>::releaseFromInterrupt()
     bool_t res( false );
     if( isConstructed() )
     {
+        #ifdef EOOS_GLOBAL_SYS_ENABLE_TRACE
+        TraceRecorder::record(EOOS_SYS_TRACE_SEMAPHORE_RELEASE_FROM_ISR, sem_);
+        #endif // EOOS_GLOBAL_SYS_ENABLE_TRACE
         xHigherPriorityTaskWoken_ = pdFALSE;
         ::BaseType_t const isGiven( ::xSemaphoreGiveFromISR(sem_, &xHigherPriorityTaskWoken_) );
         res = (isGiven == pdPASS) ? true : false;
@@ -0,0 +1,86 @@
+/**
+ * @file      sys.StaticThreads.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_STATICTHREADS_HPP_
+#define SYS_STATICTHREADS_HPP_
+
+#include "sys.Types.hpp"
+#include "api.Thread.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class StaticThreads
+ * @brief List of statically declared threads started on the system execution.
+ *
+ * The list is linked through nodes embedded into static thread objects,
+ * thus it does not need any memory, and its head is zero-initialized
+ * before any static object is constructed.
+ */
+class StaticThreads
+{
+
+public:
+
+    /**
+     * @struct Node
+     * @brief Node of the list.
+     */
+    struct Node
+    {
+        /**
+         * @brief Constructor.
+         *
+         * @param thread A static thread.
+         */
+        Node(api::Thread& thread);
+
+        /**
+         * @brief The static thread.
+         */
+        api::Thread* thread;
+
+        /**
+         * @brief Next node.
+         */
+        Node* next;
+    };
+
+    /**
+     * @brief Adds a static thread to the list.
+     *
+     * @param node A node of the static thread.
+     */
+    static void add(Node& node);
+
+    /**
+     * @brief Removes a static thread from the list.
+     *
+     * @param node A node of the static thread.
+     */
+    static void remove(Node& node);
+
+    /**
+     * @brief Executes all static threads of the list.
+     *
+     * @return True if all the threads are executed.
+     */
+    static bool_t execute();
+
+private:
+
+    /**
+     * @brief Head of the list.
+     */
+    static Node* head_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_STATICTHREADS_HPP_
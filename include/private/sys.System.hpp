@@ -15,8 +15,24 @@
 #include "sys.MutexManager.hpp"
 #include "sys.SemaphoreManager.hpp"
 #include "sys.StreamManager.hpp"
+#include "sys.TimerManager.hpp"
+#include "sys.EventGroupManager.hpp"
+#include "sys.RealTimeManager.hpp"
+#include "sys.BudgetManager.hpp"
+#include "sys.TraceRecorder.hpp"
+#include "sys.Watchdog.hpp"
+#include "sys.CrashRecord.hpp"
 #include "sys.Error.hpp"
 
+/**
+ * @brief Enables the global variable self checks on the system construction.
+ *
+ * The fast boot skips the checks, unless they are enabled for debug builds.
+ */
+#if !defined(EOOS_GLOBAL_SYS_ENABLE_FAST_BOOT) || defined(EOOS_GLOBAL_SYS_ENABLE_VAR_CHECK)
+    #define EOOS_SYS_ENABLE_VAR_CHECK
+#endif
+
 namespace eoos
 {
 namespace sys
@@ -66,6 +82,68 @@ public:
      * @copydoc eoos::api::Supervisor::getProcessor()
      */
     virtual api::CpuProcessor& getProcessor();
+
+    /**
+     * @brief Returns the software timer sub-system manager.
+     *
+     * @return The software timer sub-system manager.
+     */
+    TimerManager& getTimerManager();
+
+    /**
+     * @brief Returns the event group sub-system manager.
+     *
+     * @return The event group sub-system manager.
+     */
+    EventGroupManager& getEventGroupManager();
+
+    /**
+     * @brief Returns the real-time admission control manager.
+     *
+     * @return The real-time admission control manager.
+     */
+    RealTimeManager& getRealTimeManager();
+
+    /**
+     * @brief Returns the thread CPU budget manager.
+     *
+     * @return The thread CPU budget manager.
+     */
+    BudgetManager& getBudgetManager();
+
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_TRACE
+
+    /**
+     * @brief Returns the kernel trace recorder.
+     *
+     * @return The kernel trace recorder.
+     */
+    TraceRecorder& getTraceRecorder();
+
+    #endif // EOOS_GLOBAL_SYS_ENABLE_TRACE
+
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_WATCHDOG
+
+    /**
+     * @brief Returns the software watchdog.
+     *
+     * @return The software watchdog.
+     */
+    Watchdog& getWatchdog();
+
+    #endif // EOOS_GLOBAL_SYS_ENABLE_WATCHDOG
+
+    /**
+     * @brief Returns the crash record written by the system termination before the reset.
+     *
+     * @return The crash record, or NULLPTR if no record written.
+     */
+    CrashRecord::Record const* getCrashRecord() const;
+
+    /**
+     * @brief Clears the crash record.
+     */
+    void clearCrashRecord();
         
     /**
      * @brief Runs the EOOS system.
@@ -91,6 +169,17 @@ public:
     static System& getSystem();
 
 private:
+
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_WATCHDOG
+
+    /**
+     * @brief The watchdog terminates the system on a failure.
+     */
+    friend class Watchdog;
+
+    #endif // EOOS_GLOBAL_SYS_ENABLE_WATCHDOG
+
+    #ifdef EOOS_SYS_ENABLE_VAR_CHECK
     
     /**
      * @struct Check variable of global object.
@@ -123,6 +212,8 @@ private:
         uint32_t value;
 
     };
+
+    #endif // EOOS_SYS_ENABLE_VAR_CHECK
     
     /**
      * @brief Constructor.
@@ -157,6 +248,8 @@ private:
      */
     static void exit(Error error);
 
+    #ifdef EOOS_SYS_ENABLE_VAR_CHECK
+
     /**
      * @brief Returns a value.
      *
@@ -170,6 +263,8 @@ private:
      * @param True if values are correct.
      */
     static bool_t isVarChecked();
+
+    #endif // EOOS_SYS_ENABLE_VAR_CHECK
     
     /**
      * @brief Operator new.
@@ -191,6 +286,8 @@ private:
      */
     static System* eoos_;
 
+    #ifdef EOOS_SYS_ENABLE_VAR_CHECK
+
     /**
      * @brief Check variable in .bss section.
      */
@@ -220,6 +317,17 @@ private:
      * @brief Check variable of global object.
      */
     static Check varObjectByTwoValues_;
+
+    #endif // EOOS_SYS_ENABLE_VAR_CHECK
+
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_TRACE
+
+    /**
+     * @brief The kernel trace recorder.
+     */
+    TraceRecorder trace_;
+
+    #endif // EOOS_GLOBAL_SYS_ENABLE_TRACE
     
     /**
      * @brief The target processor.
@@ -250,6 +358,35 @@ private:
      * @brief The stream sub-system manager.
      */
     StreamManager streamManager_;
+
+    /**
+     * @brief The software timer sub-system manager.
+     */
+    TimerManager timerManager_;
+
+    /**
+     * @brief The event group sub-system manager.
+     */
+    EventGroupManager eventGroupManager_;
+
+    /**
+     * @brief The real-time admission control manager.
+     */
+    RealTimeManager realTimeManager_;
+
+    /**
+     * @brief The thread CPU budget manager.
+     */
+    BudgetManager budgetManager_;
+
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_WATCHDOG
+
+    /**
+     * @brief The software watchdog.
+     */
+    Watchdog watchdog_;
+
+    #endif // EOOS_GLOBAL_SYS_ENABLE_WATCHDOG
     
     /**
      * @brief The FreeRTOS kernel port.
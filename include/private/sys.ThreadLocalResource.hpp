@@ -0,0 +1,162 @@
+/**
+ * @file      sys.ThreadLocalResource.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_THREADLOCALRESOURCE_HPP_
+#define SYS_THREADLOCALRESOURCE_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.ThreadRegistry.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ThreadLocalResource
+ * @brief Thread local variable resource class.
+ *
+ * The variable occupies one FreeRTOS thread local storage slot, and keeps
+ * a pointer to a value of each thread. The value is not owned by the variable.
+ *
+ * @tparam T Type of values.
+ * @tparam A Heap memory allocator class.
+ */
+template <typename T, class A>
+class ThreadLocalResource : public NonCopyable<A>
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    ThreadLocalResource();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~ThreadLocalResource();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Returns the value of the current thread.
+     *
+     * @return The value, or NULLPTR if it is not set.
+     */
+    T* get() const;
+
+    /**
+     * @brief Sets the value of the current thread.
+     *
+     * @param value A value or NULLPTR.
+     * @return True if the value is set.
+     */
+    bool_t set(T* value);
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Tests if the current thread is defined.
+     *
+     * @return True if the scheduler has been started.
+     */
+    static bool_t isScheduled();
+
+    /**
+     * @brief Index of the thread local storage slot.
+     */
+    ::BaseType_t index_;
+
+};
+
+template <typename T, class A>
+ThreadLocalResource<T,A>::ThreadLocalResource()
+    : NonCopyable<A>()
+    , index_( ThreadRegistry::TLS_INDEX ) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <typename T, class A>
+ThreadLocalResource<T,A>::~ThreadLocalResource()
+{
+    ThreadRegistry::freeLocal(index_);
+}
+
+template <typename T, class A>
+bool_t ThreadLocalResource<T,A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <typename T, class A>
+T* ThreadLocalResource<T,A>::get() const
+{
+    T* value( NULLPTR );
+    if( isConstructed() && isScheduled() )
+    {
+        value = reinterpret_cast<T*>( ::pvTaskGetThreadLocalStoragePointer(NULL, index_) );
+    }
+    return value;
+}
+
+template <typename T, class A>
+bool_t ThreadLocalResource<T,A>::set(T* value)
+{
+    bool_t res( false );
+    if( isConstructed() && isScheduled() )
+    {
+        ::vTaskSetThreadLocalStoragePointer(NULL, index_, value);
+        res = true;
+    }
+    return res;
+}
+
+template <typename T, class A>
+bool_t ThreadLocalResource<T,A>::construct()
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {   ///< UT Justified Branch: HW dependency
+            break;
+        }
+        index_ = ThreadRegistry::allocateLocal();
+        if( index_ == ThreadRegistry::TLS_INDEX )
+        {
+            break;
+        }
+        res = true;
+    } while(false);
+    return res;
+}
+
+template <typename T, class A>
+bool_t ThreadLocalResource<T,A>::isScheduled()
+{
+    return ::xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_THREADLOCALRESOURCE_HPP_
@@ -0,0 +1,378 @@
+/**
+ * @file      sys.ThreadPoolResource.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_THREADPOOLRESOURCE_HPP_
+#define SYS_THREADPOOLRESOURCE_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.ThreadWorkers.hpp"
+#include "sys.TimeMap.hpp"
+#include "api.Runnable.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ThreadPoolResource
+ * @brief Thread pool resource class.
+ *
+ * The pool executes jobs by a fixed number of worker threads created once.
+ * Submitted jobs are passed to the workers through a bounded FreeRTOS queue,
+ * thus submitting a job costs one queue send and never creates a task.
+ *
+ * @tparam A Heap memory allocator class.
+ * @tparam N Number of worker threads.
+ * @tparam L Maximum number of pending jobs.
+ * @tparam S Stack size of worker threads in Bytes aligned to 8.
+ */
+template <class A, int32_t N, uint32_t L, size_t S>
+class ThreadPoolResource : public NonCopyable<A>
+{
+    typedef NonCopyable<A> Parent;
+
+    EOOS_SYS_STATIC_ASSERT(L > 0, "Thread pool shall have a queue");
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param priority A priority of worker threads.
+     */
+    ThreadPoolResource(int32_t priority);
+
+    /**
+     * @brief Destructor.
+     *
+     * Waits for all submitted jobs are done, and terminates the worker threads.
+     *
+     * @note The pool shall not be destroyed by its worker thread.
+     */
+    virtual ~ThreadPoolResource();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Submits a job to be executed by a worker thread.
+     *
+     * @param job A job whose main method is invoked by a worker thread.
+     * @return True if the job is queued.
+     */
+    bool_t submit(api::Runnable& job);
+
+    /**
+     * @brief Submits a job waiting for a free place in the queue.
+     *
+     * @param job A job whose main method is invoked by a worker thread.
+     * @param ms  A time in milliseconds to wait for a free place.
+     * @return True if the job is queued.
+     */
+    bool_t submit(api::Runnable& job, int32_t ms);
+
+    /**
+     * @brief Submits a job from interrupt service routine.
+     *
+     * @param job A job whose main method is invoked by a worker thread.
+     * @return True if the job is queued.
+     */
+    bool_t submitFromInterrupt(api::Runnable& job);
+
+    /**
+     * @brief Test if the contex has to be switched.
+     *
+     * @return True to switch contex.
+     */
+    bool_t hasToSwitchContex() const;
+
+    /**
+     * @brief Returns number of jobs waiting for a worker thread.
+     *
+     * @return Number of jobs.
+     */
+    uint32_t getNumberOfJobs() const;
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @class Routine
+     * @brief Routine of worker threads.
+     */
+    class Routine : public NonCopyable<NoAllocator>, public api::Runnable
+    {
+        typedef NonCopyable<NoAllocator> Parent;
+
+    public:
+
+        /**
+         * @brief Constructor.
+         */
+        Routine();
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~Routine();
+
+        /**
+         * @copydoc eoos::api::Object::isConstructed()
+         */
+        virtual bool_t isConstructed() const;
+
+        /**
+         * @copydoc eoos::api::Runnable::start()
+         */
+        virtual void start();
+
+        /**
+         * @brief Sets the job queue.
+         *
+         * @param queue The queue of jobs.
+         */
+        void setQueue(::QueueHandle_t queue);
+
+    private:
+
+        /**
+         * @brief The queue of jobs.
+         */
+        ::QueueHandle_t queue_;
+
+    };
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @param priority A priority of worker threads.
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct(int32_t priority);
+
+    /**
+     * @brief Initializes the job queue.
+     *
+     * @return True if initialized sucessfully.
+     */
+    bool_t initialize();
+
+    /**
+     * @brief Terminates the worker threads and deletes the job queue.
+     */
+    void deinitialize();
+
+    /**
+     * @brief Queue of jobs.
+     */
+    ::QueueHandle_t queue_;
+
+    /**
+     * @brief Queue FreeRTOS statatic buffer.
+     */
+    ::StaticQueue_t buffer_;
+
+    /**
+     * @brief Queue storage.
+     */
+    uint8_t storage_[L * sizeof(api::Runnable*)];
+
+    /**
+     * @brief Routine of worker threads.
+     */
+    Routine routine_;
+
+    /**
+     * @brief Worker threads.
+     */
+    ThreadWorkers<N,S> workers_;
+
+    /**
+     * @brief Higher priority task woken flag.
+     */
+    ::BaseType_t xHigherPriorityTaskWoken_;
+
+};
+
+template <class A, int32_t N, uint32_t L, size_t S>
+ThreadPoolResource<A,N,L,S>::ThreadPoolResource(int32_t priority)
+    : NonCopyable<A>()
+    , queue_( NULL )
+    , buffer_()
+    , storage_()
+    , routine_()
+    , workers_( routine_ )
+    , xHigherPriorityTaskWoken_( pdFALSE ) {
+    bool_t const isConstructed( construct(priority) );
+    setConstructed( isConstructed );
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+ThreadPoolResource<A,N,L,S>::~ThreadPoolResource()
+{
+    deinitialize();
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+bool_t ThreadPoolResource<A,N,L,S>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+bool_t ThreadPoolResource<A,N,L,S>::submit(api::Runnable& job)
+{
+    return submit(job, 0);
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+bool_t ThreadPoolResource<A,N,L,S>::submit(api::Runnable& job, int32_t ms)
+{
+    bool_t res( false );
+    if( isConstructed() && (ms >= 0) )
+    {
+        api::Runnable* const item( &job );
+        res = ::xQueueSend(queue_, &item, TimeMap::toTicks(ms)) == pdPASS;
+    }
+    return res;
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+bool_t ThreadPoolResource<A,N,L,S>::submitFromInterrupt(api::Runnable& job)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        api::Runnable* const item( &job );
+        xHigherPriorityTaskWoken_ = pdFALSE;
+        res = ::xQueueSendFromISR(queue_, &item, &xHigherPriorityTaskWoken_) == pdPASS;
+    }
+    return res;
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+bool_t ThreadPoolResource<A,N,L,S>::hasToSwitchContex() const
+{
+    return xHigherPriorityTaskWoken_ != pdFALSE;
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+uint32_t ThreadPoolResource<A,N,L,S>::getNumberOfJobs() const
+{
+    uint32_t number( 0 );
+    if( isConstructed() )
+    {
+        number = static_cast<uint32_t>( ::uxQueueMessagesWaiting(queue_) );
+    }
+    return number;
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+bool_t ThreadPoolResource<A,N,L,S>::construct(int32_t priority)
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {   ///< UT Justified Branch: HW dependency
+            break;
+        }
+        if( !routine_.isConstructed() )
+        {
+            break;
+        }
+        if( !workers_.isConstructed() )
+        {
+            break;
+        }
+        if( !initialize() )
+        {
+            break;
+        }
+        routine_.setQueue(queue_);
+        if( !workers_.execute(priority) )
+        {
+            break;
+        }
+        res = true;
+    } while(false);
+    return res;
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+bool_t ThreadPoolResource<A,N,L,S>::initialize()
+{
+    queue_ = ::xQueueCreateStatic(L, sizeof(api::Runnable*), storage_, &buffer_);
+    return queue_ != NULL;
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+void ThreadPoolResource<A,N,L,S>::deinitialize()
+{
+    if( queue_ != NULL )
+    {
+        // Each worker thread terminates when it takes a null job
+        api::Runnable* const item( NULLPTR );
+        for(int32_t i( 0 ); i < workers_.getNumber(); i++)
+        {
+            static_cast<void>( ::xQueueSend(queue_, &item, portMAX_DELAY) );
+        }
+        workers_.join();
+        ::vQueueDelete(queue_);
+        queue_ = NULL;
+    }
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+ThreadPoolResource<A,N,L,S>::Routine::Routine()
+    : NonCopyable<NoAllocator>()
+    , api::Runnable()
+    , queue_( NULL ) {
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+ThreadPoolResource<A,N,L,S>::Routine::~Routine()
+{
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+bool_t ThreadPoolResource<A,N,L,S>::Routine::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+void ThreadPoolResource<A,N,L,S>::Routine::start()
+{
+    while( queue_ != NULL )
+    {
+        api::Runnable* job( NULLPTR );
+        if( ::xQueueReceive(queue_, &job, portMAX_DELAY) != pdPASS )
+        {
+            continue;
+        }
+        if( job == NULLPTR )
+        {
+            break;
+        }
+        job->start();
+    }
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+void ThreadPoolResource<A,N,L,S>::Routine::setQueue(::QueueHandle_t queue)
+{
+    queue_ = queue;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_THREADPOOLRESOURCE_HPP_
@@ -0,0 +1,231 @@
+/**
+ * @file      sys.ThreadRegistry.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_THREADREGISTRY_HPP_
+#define SYS_THREADREGISTRY_HPP_
+
+#include "sys.Configuration.hpp"
+#include "api.Thread.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ThreadRegistry
+ * @brief Registry of live threads.
+ *
+ * A thread is registered by its own FreeRTOS task each time the thread task routine
+ * begins, and unregistered when the routine returns or the thread is destroyed.
+ * Thus, a thread is live only while its routine runs. The registry
+ * keeps a pointer to the thread in the reserved thread local storage slot of
+ * its task, therefore a thread is found by a task handle in constant time.
+ * The other thread local storage slots are given to thread local variables,
+ * and are cleared each time a thread is registered.
+ */
+class ThreadRegistry
+{
+
+public:
+
+    /**
+     * @struct Node
+     * @brief Registry node embedded into a thread.
+     */
+    struct Node
+    {
+        /**
+         * @brief Constructor.
+         *
+         * @param thread A thread.
+         * @param string A name of the thread to be copied.
+         */
+        Node(api::Thread& thread, char_t const* string);
+
+        /**
+         * @brief Signature which tells the node from a foreign thread local storage pointer.
+         */
+        uint32_t signature;
+
+        /**
+         * @brief The thread.
+         */
+        api::Thread* thread;
+
+        /**
+         * @brief Copy of the thread name truncated to the FreeRTOS task name length.
+         */
+        char_t name[configMAX_TASK_NAME_LEN];
+
+        /**
+         * @brief The thread FreeRTOS task.
+         */
+        ::TaskHandle_t task;
+
+        /**
+         * @brief FreeRTOS priority assigned by the real-time manager, or tskIDLE_PRIORITY if not assigned.
+         */
+        ::UBaseType_t assigned;
+
+        /**
+         * @brief Previous node.
+         */
+        Node* prev;
+
+        /**
+         * @brief Next node.
+         */
+        Node* next;
+    };
+
+    /**
+     * @brief Index of the thread local storage pointer reserved for the registry.
+     */
+    static const ::BaseType_t TLS_INDEX = 0;
+
+    /**
+     * @brief Registers a thread.
+     *
+     * The thread local storage slots of the task are cleared, so thread local
+     * variables freed while the thread was not live do not leave stale values.
+     *
+     * @param node A node of the thread.
+     * @param task A created FreeRTOS task of the thread.
+     */
+    static void add(Node& node, ::TaskHandle_t task);
+
+    /**
+     * @brief Unregisters a thread.
+     *
+     * @param node A node of the thread.
+     */
+    static void remove(Node& node);
+
+    /**
+     * @brief Assigns a FreeRTOS priority to a thread over its own priority.
+     *
+     * The assigned priority is reported by the thread as its priority, and
+     * the thread does not change its priority until the assignment is canceled.
+     *
+     * @param task     A FreeRTOS task.
+     * @param priority A FreeRTOS priority, or tskIDLE_PRIORITY to restore the thread own priority.
+     * @return True if the task is an EOOS thread and the priority is set.
+     */
+    static bool_t assign(::TaskHandle_t task, ::UBaseType_t priority);
+
+    /**
+     * @brief Returns the FreeRTOS base priority of a thread, which is not inherited from a mutex.
+     *
+     * @param task     A FreeRTOS task.
+     * @param priority The assigned priority, or the FreeRTOS priority of the thread own one.
+     * @return True if the task is an EOOS thread.
+     */
+    static bool_t getPriority(::TaskHandle_t task, ::UBaseType_t& priority);
+
+    /**
+     * @brief Returns the thread of a FreeRTOS task.
+     *
+     * @param task A FreeRTOS task or NULL for the calling task.
+     * @return The thread, or NULLPTR if the task is not an EOOS thread.
+     */
+    static api::Thread* getThread(::TaskHandle_t task);
+
+    /**
+     * @brief Returns the name of a FreeRTOS task thread.
+     *
+     * @param task A FreeRTOS task or NULL for the calling task.
+     * @return The thread name, or NULLPTR if the task is not an EOOS thread.
+     */
+    static char_t const* getName(::TaskHandle_t task);
+
+    /**
+     * @brief Returns number of live threads.
+     *
+     * @return Number of threads.
+     */
+    static int32_t getNumberOfThreads();
+
+    /**
+     * @brief Copies live threads to an array.
+     *
+     * @param threads An array for the threads.
+     * @param size    Number of elements of the array.
+     * @return Number of copied threads.
+     */
+    static int32_t getThreads(api::Thread* threads[], int32_t size);
+
+    /**
+     * @brief Copies FreeRTOS tasks of live threads to an array.
+     *
+     * @param tasks An array for the tasks.
+     * @param size  Number of elements of the array.
+     * @return Number of copied tasks.
+     */
+    static int32_t getTasks(::TaskHandle_t tasks[], int32_t size);
+
+    /**
+     * @brief Copies FreeRTOS tasks of live threads to an array from interrupt service routine.
+     *
+     * @param tasks An array for the tasks.
+     * @param size  Number of elements of the array.
+     * @return Number of copied tasks.
+     */
+    static int32_t getTasksFromInterrupt(::TaskHandle_t tasks[], int32_t size);
+
+    /**
+     * @brief Allocates a thread local storage slot.
+     *
+     * @return Index of the slot, or TLS_INDEX if no free slots.
+     */
+    static ::BaseType_t allocateLocal();
+
+    /**
+     * @brief Frees a thread local storage slot.
+     *
+     * The slot is cleared in all live threads, and the other threads clear it when registered.
+     *
+     * @param index Index of the slot.
+     */
+    static void freeLocal(::BaseType_t index);
+
+private:
+
+    /**
+     * @brief Returns the node of a FreeRTOS task thread.
+     *
+     * @param task A FreeRTOS task or NULL for the calling task.
+     * @return The node, or NULLPTR if the task is not an EOOS thread.
+     */
+    static Node* getNode(::TaskHandle_t task);
+
+    /**
+     * @brief Signature of registry nodes.
+     */
+    static const uint32_t SIGNATURE = 0xEC0F70DEU;
+
+    /**
+     * @brief Head of the registered threads.
+     */
+    static Node* head_;
+
+    /**
+     * @brief Number of the registered threads.
+     */
+    static int32_t number_;
+
+    /**
+     * @brief Bit mask of allocated thread local storage slots.
+     */
+    static uint32_t locals_;
+
+};
+
+EOOS_SYS_STATIC_ASSERT(configNUM_THREAD_LOCAL_STORAGE_POINTERS > ThreadRegistry::TLS_INDEX, "configNUM_THREAD_LOCAL_STORAGE_POINTERS shall be positive");
+EOOS_SYS_STATIC_ASSERT(configNUM_THREAD_LOCAL_STORAGE_POINTERS <= 32, "configNUM_THREAD_LOCAL_STORAGE_POINTERS shall not exceed 32");
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_THREADREGISTRY_HPP_
@@ -7,8 +7,11 @@
 #define SYS_THREADRESOURCE_HPP_
 
 #include "sys.NonCopyable.hpp"
+#include "sys.Configuration.hpp"
 #include "api.Thread.hpp"
 #include "api.Task.hpp"
+#include "sys.ThreadRegistry.hpp"
+#include "sys.PriorityMap.hpp"
 
 namespace eoos
 {
@@ -20,12 +23,16 @@ namespace sys
  * @brief Thread resource class.
  * 
  * @tparam A Heap memory allocator class.
+ * @tparam S Stack size in Bytes aligned to 8.
  */
-template <class A>
+template <class A, size_t S = Configuration::THREAD_STACK_SIZE>
 class ThreadResource : public NonCopyable<A>, public api::Thread
 {
     typedef NonCopyable<A> Parent;
 
+    EOOS_SYS_STATIC_ASSERT((S & 0x7) == 0, "Thread stack size shall be aligned to 8");
+    EOOS_SYS_STATIC_ASSERT(S >= Configuration::THREAD_STACK_SIZE_MIN, "Thread stack size shall not be less than configMINIMAL_STACK_SIZE");
+
 public:
 
     /**
@@ -35,6 +42,14 @@ public:
      */
     ThreadResource(api::Task& task);
 
+    /**
+     * @brief Constructor of not constructed object.
+     *
+     * @param task A task interface whose main method is invoked when this thread is started.
+     * @param name A name of this thread for debug purposes.
+     */
+    ThreadResource(api::Task& task, char_t const* name);
+
     /**
      * @brief Destructor.
      */
@@ -65,6 +80,45 @@ public:
      */
     virtual bool_t setPriority(int32_t priority);
 
+    /**
+     * @brief Returns this thread name.
+     *
+     * @return The name.
+     */
+    char_t const* getName() const;
+
+    /**
+     * @brief Returns the effective priority of this thread.
+     *
+     * The effective priority is higher than the set one while the thread
+     * inherits a priority of a thread blocked on a mutex held by this thread.
+     *
+     * @return The effective priority, or PRIORITY_WRONG if an error has been occurred.
+     */
+    int32_t getEffectivePriority() const;
+
+    /**
+     * @brief Restarts this finished thread with a new task.
+     *
+     * The FreeRTOS task and the stack of this thread are reused, thus the
+     * restart costs no kernel object creation.
+     *
+     * @param task A task interface whose main method is invoked when this thread is restarted.
+     * @return True if this thread is restarted.
+     */
+    bool_t restart(api::Task& task);
+
+    /**
+     * @brief Detaches this thread.
+     *
+     * A detached thread is deleted by the timer daemon task after its task
+     * routine returns, and the memory of the thread is returned to the allocator.
+     * Therefore the thread object shall not be used after the call.
+     *
+     * @return True if this thread is detached.
+     */
+    bool_t detach();
+
 protected:
 
     using Parent::setConstructed;
@@ -78,43 +132,58 @@ private:
      */
     bool_t construct();
 
+
     /**
-     * @brief Converts priority EOOS API to FreeRTOS API.
+     * @brief Starts a thread routine.
      *
-     * @param priority A EOOS priority.
-     * @return A FreeRTOS priority.
+     * @param pvParameters Pointer to arguments passed to the thread.
      */
-    static ::UBaseType_t convertPriority(int32_t priority);
-    
+    static void start(void* pvParameters);
+
     /**
-     * @brief Tests priority is valid.
+     * @brief Deletes a detached thread by the timer daemon.
      *
-     * @param priority A priority level.
-     * @return True if is valid.
+     * @param pvParameter1 The thread to delete.
+     * @param ulParameter2 Unused.
      */
-    static bool_t isPriority(int32_t priority);
+    static void reclaim(void* pvParameter1, uint32_t ulParameter2);
 
     /**
-     * @brief Starts a thread routine.
+     * @brief Passes this detached thread to the timer daemon to delete.
      *
-     * @param pvParameters Pointer to arguments passed to the thread.
+     * @return True if the thread is passed.
      */
-    static void start(void* pvParameters);
+    bool_t pendReclaim();
 
     /**
      * @brief Nubmer of stack elements of uint32_t.
      */    
-    static const uint32_t THREAD_STACK_DEPTH = EOOS_GLOBAL_SYS_FREERTOS_TASK_STACK_SIZE / 4;
+    static const uint32_t THREAD_STACK_DEPTH = S / 4;
     
+    /**
+     * @brief Default name of threads.
+     */
+    static char_t const* const DEFAULT_NAME;
+
     /**
      * @brief User executing runnable interface.
      */
     api::Task* task_;
 
+    /**
+     * @brief This thread node of the live threads registry.
+     */
+    ThreadRegistry::Node node_;
+
     /**
      * @brief Current status.
      */
     Status status_;
+
+    /**
+     * @brief Detached flag.
+     */
+    bool_t isDetached_;
     
     /**
      * @brief This thread priority.
@@ -138,12 +207,17 @@ private:
 
 };
 
-template <class A>
-ThreadResource<A>::ThreadResource(api::Task& task) 
+template <class A, size_t S>
+char_t const* const ThreadResource<A,S>::DEFAULT_NAME( "EOOS Thread" );
+
+template <class A, size_t S>
+ThreadResource<A,S>::ThreadResource(api::Task& task) 
     : NonCopyable<A>()
     , api::Thread()
     , task_( &task )
+    , node_( *this, DEFAULT_NAME )
     , status_( STATUS_NEW )
+    , isDetached_( false )
     , priority_( PRIORITY_NORM )
     , thread_( NULL )
     , tcb_() {
@@ -151,9 +225,25 @@ ThreadResource<A>::ThreadResource(api::Task& task)
     setConstructed( isConstructed );
 }
 
-template <class A>
-ThreadResource<A>::~ThreadResource()
+template <class A, size_t S>
+ThreadResource<A,S>::ThreadResource(api::Task& task, char_t const* name) 
+    : NonCopyable<A>()
+    , api::Thread()
+    , task_( &task )
+    , node_( *this, (name != NULLPTR) ? name : DEFAULT_NAME )
+    , status_( STATUS_NEW )
+    , isDetached_( false )
+    , priority_( PRIORITY_NORM )
+    , thread_( NULL )
+    , tcb_() {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <class A, size_t S>
+ThreadResource<A,S>::~ThreadResource()
 {
+    ThreadRegistry::remove(node_);
     if( thread_ != NULL )
     {
         ::vTaskDelete( thread_ );
@@ -161,14 +251,14 @@ ThreadResource<A>::~ThreadResource()
     }
 }
 
-template <class A>
-bool_t ThreadResource<A>::isConstructed() const ///< SCA MISRA-C++:2008 Justified Rule 10-3-1
+template <class A, size_t S>
+bool_t ThreadResource<A,S>::isConstructed() const ///< SCA MISRA-C++:2008 Justified Rule 10-3-1
 {
     return Parent::isConstructed();
 }
 
-template <class A>
-bool_t ThreadResource<A>::execute()
+template <class A, size_t S>
+bool_t ThreadResource<A,S>::execute()
 {
     bool_t res( false );
     do{
@@ -181,12 +271,17 @@ bool_t ThreadResource<A>::execute()
             break;
         }
         ::TaskFunction_t pvTaskCode( start );
-        const char* pcName( "EOOS Thread" );
+        const char* pcName( node_.name );
         uint32_t ulStackDepth( THREAD_STACK_DEPTH );
         void* pvParameters( this );
-        ::UBaseType_t uxPriority( convertPriority(priority_) );
+        ::UBaseType_t uxPriority( PriorityMap::toKernel(priority_) );
         ::StackType_t* puxStackBuffer( reinterpret_cast<::StackType_t*>(stack_) );
         ::StaticTask_t* pxTaskBuffer( &tcb_ );
+        // The new task may preempt the caller and even finish, thus the scheduler
+        // is suspended till the handle and status are set. Otherwise, the finished
+        // task status would be overwritten, or a detached thread would be reclaimed
+        // before its handle is known.
+        ::vTaskSuspendAll();
         thread_ = ::xTaskCreateStatic( 
             pvTaskCode,         // The function that implements the task.
             pcName,             // The text name assigned to the task - for debug only as it is not used by the kernel.
@@ -196,18 +291,18 @@ bool_t ThreadResource<A>::execute()
             puxStackBuffer,     // The stack buffer
             pxTaskBuffer        // The task control block
         );
-        if( thread_ == NULL )
+        if( thread_ != NULL )
         {
-            break;
-        }        
-        status_ = STATUS_RUNNABLE;
-        res = true;
+            status_ = STATUS_RUNNABLE;
+            res = true;
+        }
+        static_cast<void>( ::xTaskResumeAll() );
     } while(false);
     return res;        
 }
 
-template <class A>
-bool_t ThreadResource<A>::join()
+template <class A, size_t S>
+bool_t ThreadResource<A,S>::join()
 {
     bool_t res( false );    
     if( isConstructed() && (status_ == STATUS_RUNNABLE) )
@@ -225,30 +320,49 @@ bool_t ThreadResource<A>::join()
     return res;
 }
 
-template <class A>
-int32_t ThreadResource<A>::getPriority() const
+template <class A, size_t S>
+int32_t ThreadResource<A,S>::getPriority() const
 {
-    return isConstructed() ? priority_ : PRIORITY_WRONG;        
+    int32_t priority( PRIORITY_WRONG );
+    if( isConstructed() )
+    {
+        priority = priority_;
+        // A priority assigned by the real-time manager overrides the set one
+        ::UBaseType_t const assigned( node_.assigned );
+        if( assigned != tskIDLE_PRIORITY )
+        {
+            priority = PriorityMap::toEoos(assigned);
+        }
+    }
+    return priority;
 }
 
-template <class A>
-bool_t ThreadResource<A>::setPriority(int32_t priority)
+template <class A, size_t S>
+bool_t ThreadResource<A,S>::setPriority(int32_t priority)
 {
     bool_t res( false );
-    if( isConstructed() && isPriority(priority) )
+    if( isConstructed() && PriorityMap::isPriority(priority) )
     {
         switch( status_ )
         {
             case STATUS_RUNNABLE:
             {
-                ::UBaseType_t uxNewPriority( convertPriority(priority) );
-                ::vTaskPrioritySet( thread_, uxNewPriority );
-                priority_ = priority;
+                // The scheduler is suspended to serialize with the real-time manager assignment
+                ::vTaskSuspendAll();
+                if( node_.assigned == tskIDLE_PRIORITY )
+                {
+                    ::UBaseType_t uxNewPriority( PriorityMap::toKernel(priority) );
+                    ::vTaskPrioritySet( thread_, uxNewPriority );
+                    priority_ = priority;
+                    res = true;
+                }
+                static_cast<void>( ::xTaskResumeAll() );
                 break;
             }
             case STATUS_NEW:
             {
                 priority_ = priority;                
+                res = true;
                 break;
             }
             default:
@@ -260,8 +374,82 @@ bool_t ThreadResource<A>::setPriority(int32_t priority)
     return res;
 }
 
-template <class A>
-bool_t ThreadResource<A>::construct()
+template <class A, size_t S>
+int32_t ThreadResource<A,S>::getEffectivePriority() const
+{
+    int32_t priority( PRIORITY_WRONG );
+    if( isConstructed() )
+    {
+        priority = getPriority();
+        if( status_ == STATUS_RUNNABLE )
+        {
+            // Several EOOS levels may share a FreeRTOS priority, thus
+            // only a priority inherited above the own one is converted
+            ::UBaseType_t const assigned( node_.assigned );
+            ::UBaseType_t const base( (assigned != tskIDLE_PRIORITY) ? assigned : PriorityMap::toKernel(priority_) );
+            ::UBaseType_t const effective( ::uxTaskPriorityGet(thread_) );
+            if( effective > base )
+            {
+                priority = PriorityMap::toEoos(effective);
+            }
+        }
+    }
+    return priority;
+}
+
+template <class A, size_t S>
+char_t const* ThreadResource<A,S>::getName() const
+{
+    return node_.name;
+}
+
+template <class A, size_t S>
+bool_t ThreadResource<A,S>::restart(api::Task& task)
+{
+    bool_t res( false );
+    if( isConstructed() && task.isConstructed() )
+    {
+        taskENTER_CRITICAL();
+        if( (status_ == STATUS_DEAD) && (thread_ != NULL) && !isDetached_ )
+        {
+            task_ = &task;
+            status_ = STATUS_RUNNABLE;
+            res = true;
+        }
+        taskEXIT_CRITICAL();
+        if( res )
+        {
+            static_cast<void>( ::xTaskNotifyGive(thread_) );
+        }
+    }
+    return res;
+}
+
+template <class A, size_t S>
+bool_t ThreadResource<A,S>::detach()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        bool_t isDead( false );
+        taskENTER_CRITICAL();
+        if( !isDetached_ )
+        {
+            isDetached_ = true;
+            isDead = status_ == STATUS_DEAD;
+            res = true;
+        }
+        taskEXIT_CRITICAL();
+        if( isDead )
+        {
+            res = pendReclaim();
+        }
+    }
+    return res;
+}
+
+template <class A, size_t S>
+bool_t ThreadResource<A,S>::construct()
 {  
     bool_t res( false );
     do
@@ -270,7 +458,7 @@ bool_t ThreadResource<A>::construct()
         {   ///< UT Justified Branch: HW dependency
             break;
         }
-        if( PRIORITY_MAX >= configMAX_PRIORITIES )
+        if( !PriorityMap::isValid() )
         {
             break;
         }
@@ -292,33 +480,8 @@ bool_t ThreadResource<A>::construct()
     return res;    
 }
 
-template <class A>
-::UBaseType_t ThreadResource<A>::convertPriority(int32_t priority)
-{
-    return static_cast<::UBaseType_t>(priority);
-}
-
-template <class A>
-bool_t ThreadResource<A>::isPriority(int32_t priority)
-{   
-    bool_t res( false );
-    if( (PRIORITY_MIN <= priority) && (priority <= PRIORITY_MAX) )
-    {
-        res = true;
-    }
-    else if (priority == PRIORITY_IDLE)
-    {
-        res = true;
-    }
-    else 
-    {
-        res = false;
-    }
-    return res;
-}
-
-template <class A>
-void ThreadResource<A>::start(void* pvParameters)
+template <class A, size_t S>
+void ThreadResource<A,S>::start(void* pvParameters)
 {
     ThreadResource* thread( NULLPTR );
     do
@@ -332,12 +495,27 @@ void ThreadResource<A>::start(void* pvParameters)
         {
             break;
         }                
-        if( !thread->task_->isConstructed() )
+        while( thread->task_->isConstructed() )
         {
-            break;
-        }        
-        thread->task_->start();
-        thread->status_ = STATUS_DEAD;
+            ThreadRegistry::add(thread->node_, ::xTaskGetCurrentTaskHandle());
+            thread->task_->start();
+            ThreadRegistry::remove(thread->node_);
+            bool_t isDetached( false );
+            taskENTER_CRITICAL();
+            thread->status_ = STATUS_DEAD;
+            isDetached = thread->isDetached_;
+            taskEXIT_CRITICAL();
+            if( isDetached )
+            {
+                // The daemon deletes this task while it waits below
+                static_cast<void>( thread->pendReclaim() );
+            }
+            // Keep the task control block and the stack for a restart
+            while( thread->status_ == STATUS_DEAD )
+            {
+                static_cast<void>( ::ulTaskNotifyTake(pdTRUE, portMAX_DELAY) );
+            }
+        }
     } while(false);
     ::vTaskSuspend(NULL);
     // @note From The FreeRTOS Reference Manual:
@@ -348,6 +526,21 @@ void ThreadResource<A>::start(void* pvParameters)
     // the task exit address and terminate FreeRTOS port execution.
 }
 
+template <class A, size_t S>
+void ThreadResource<A,S>::reclaim(void* pvParameter1, uint32_t ulParameter2)
+{
+    static_cast<void>(ulParameter2); // Avoid MISRA-C++:2008 Rule 0–1–3 and AUTOSAR C++14 Rule A0-1-4
+    ThreadResource* const thread( reinterpret_cast<ThreadResource*>(pvParameter1) );
+    delete thread;
+}
+
+template <class A, size_t S>
+bool_t ThreadResource<A,S>::pendReclaim()
+{
+    ::BaseType_t const isPended( ::xTimerPendFunctionCall(reclaim, this, 0, portMAX_DELAY) );
+    return isPended == pdPASS;
+}
+
 } // namespace sys
 } // namespace eoos
 #endif // SYS_THREADRESOURCE_HPP_
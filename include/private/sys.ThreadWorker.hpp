@@ -0,0 +1,85 @@
+/**
+ * @file      sys.ThreadWorker.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_THREADWORKER_HPP_
+#define SYS_THREADWORKER_HPP_
+
+#include "sys.ThreadLocalResource.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ThreadWorker
+ * @brief Identity of a worker thread in its set of workers.
+ *
+ * A worker thread keeps its identity in one thread local storage slot shared
+ * by all sets of workers, therefore a thread finds out in constant time if it
+ * is a worker of a set, and its index in the set.
+ */
+class ThreadWorker
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    ThreadWorker();
+
+    /**
+     * @brief Sets the identity.
+     *
+     * @param owner A set of workers.
+     * @param index An index of the worker in the set.
+     */
+    void set(void const* owner, int32_t index);
+
+    /**
+     * @brief Binds this identity to the calling thread.
+     *
+     * @return True if bound.
+     */
+    bool_t bind();
+
+    /**
+     * @brief Returns the index of the calling thread in a set of workers.
+     *
+     * @param owner A set of workers.
+     * @return The index, or -1 if the caller is not a worker of the set.
+     */
+    static int32_t getIndex(void const* owner);
+
+    /**
+     * @brief Tests if the thread local storage slot of identities is allocated.
+     *
+     * @return True if workers can be identified.
+     */
+    static bool_t isAvailable();
+
+private:
+
+    /**
+     * @brief The set of workers.
+     */
+    void const* owner_;
+
+    /**
+     * @brief The index of the worker in the set.
+     */
+    int32_t index_;
+
+    /**
+     * @brief Identities of worker threads.
+     */
+    static ThreadLocalResource<ThreadWorker,NoAllocator> local_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_THREADWORKER_HPP_
@@ -0,0 +1,312 @@
+/**
+ * @file      sys.ThreadWorkers.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_THREADWORKERS_HPP_
+#define SYS_THREADWORKERS_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.ThreadResource.hpp"
+#include "sys.ThreadWorker.hpp"
+#include "api.Runnable.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ThreadWorkers
+ * @brief Set of worker threads of thread pools.
+ *
+ * All worker threads execute one routine, which takes jobs of a pool
+ * until the pool stops it. A worker finds its index in the set in constant time.
+ *
+ * @tparam N Number of worker threads.
+ * @tparam S Stack size of worker threads in Bytes aligned to 8.
+ */
+template <int32_t N, size_t S>
+class ThreadWorkers : public NonCopyable<NoAllocator>
+{
+    typedef NonCopyable<NoAllocator> Parent;
+
+    EOOS_SYS_STATIC_ASSERT(N > 0, "Thread pool shall have workers");
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param routine A routine executed by each worker thread.
+     */
+    ThreadWorkers(api::Runnable& routine);
+
+    /**
+     * @brief Destructor.
+     *
+     * @note The routine shall be stopped and the worker threads shall be joined.
+     */
+    virtual ~ThreadWorkers();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Executes the worker threads.
+     *
+     * @param priority A priority of worker threads.
+     * @return True if all worker threads are executed.
+     */
+    bool_t execute(int32_t priority);
+
+    /**
+     * @brief Waits for the executed worker threads are finished.
+     */
+    void join();
+
+    /**
+     * @brief Returns number of executed worker threads.
+     *
+     * @return Number of threads.
+     */
+    int32_t getNumber() const;
+
+    /**
+     * @brief Returns the worker index of the calling thread.
+     *
+     * @return The index, or -1 if the caller is not a worker of this set.
+     */
+    int32_t getIndex() const;
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @class Worker
+     * @brief Task of a worker thread.
+     */
+    class Worker : public NonCopyable<NoAllocator>, public api::Task
+    {
+        typedef NonCopyable<NoAllocator> Parent;
+
+    public:
+
+        /**
+         * @brief Constructor.
+         */
+        Worker();
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~Worker();
+
+        /**
+         * @copydoc eoos::api::Object::isConstructed()
+         */
+        virtual bool_t isConstructed() const;
+
+        /**
+         * @copydoc eoos::api::Runnable::start()
+         */
+        virtual void start();
+
+        /**
+         * @copydoc eoos::api::Task::getStackSize()
+         */
+        virtual size_t getStackSize() const;
+
+        /**
+         * @brief Sets the routine of the worker.
+         *
+         * @param routine The routine.
+         * @param owner   The set of workers.
+         * @param index   The worker index.
+         */
+        void set(api::Runnable& routine, ThreadWorkers const* owner, int32_t index);
+
+        /**
+         * @brief The worker thread.
+         */
+        ThreadResource<NoAllocator,S> thread;
+
+    private:
+
+        /**
+         * @brief The routine.
+         */
+        api::Runnable* routine_;
+
+        /**
+         * @brief The worker identity.
+         */
+        ThreadWorker identity_;
+
+    };
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @param routine A routine executed by each worker thread.
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct(api::Runnable& routine);
+
+    /**
+     * @brief Worker threads.
+     */
+    Worker workers_[N];
+
+    /**
+     * @brief Number of executed worker threads.
+     */
+    int32_t number_;
+
+};
+
+template <int32_t N, size_t S>
+ThreadWorkers<N,S>::ThreadWorkers(api::Runnable& routine)
+    : NonCopyable<NoAllocator>()
+    , workers_()
+    , number_( 0 ) {
+    bool_t const isConstructed( construct(routine) );
+    setConstructed( isConstructed );
+}
+
+template <int32_t N, size_t S>
+ThreadWorkers<N,S>::~ThreadWorkers()
+{
+}
+
+template <int32_t N, size_t S>
+bool_t ThreadWorkers<N,S>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <int32_t N, size_t S>
+bool_t ThreadWorkers<N,S>::execute(int32_t priority)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = true;
+        for(int32_t i( number_ ); i < N; i++)
+        {
+            ThreadResource<NoAllocator,S>& thread( workers_[i].thread );
+            if( !thread.setPriority(priority) )
+            {
+                res = false;
+                break;
+            }
+            if( !thread.execute() )
+            {
+                res = false;
+                break;
+            }
+            number_++;
+        }
+    }
+    return res;
+}
+
+template <int32_t N, size_t S>
+void ThreadWorkers<N,S>::join()
+{
+    for(int32_t i( 0 ); i < number_; i++)
+    {
+        static_cast<void>( workers_[i].thread.join() );
+    }
+    number_ = 0;
+}
+
+template <int32_t N, size_t S>
+int32_t ThreadWorkers<N,S>::getNumber() const
+{
+    return number_;
+}
+
+template <int32_t N, size_t S>
+int32_t ThreadWorkers<N,S>::getIndex() const
+{
+    return ThreadWorker::getIndex(this);
+}
+
+template <int32_t N, size_t S>
+bool_t ThreadWorkers<N,S>::construct(api::Runnable& routine)
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {   ///< UT Justified Branch: HW dependency
+            break;
+        }
+        res = true;
+        for(int32_t i( 0 ); i < N; i++)
+        {
+            Worker& worker( workers_[i] );
+            worker.set(routine, this, i);
+            if( !worker.thread.isConstructed() )
+            {
+                res = false;
+                break;
+            }
+        }
+    } while(false);
+    return res;
+}
+
+template <int32_t N, size_t S>
+ThreadWorkers<N,S>::Worker::Worker()
+    : NonCopyable<NoAllocator>()
+    , api::Task()
+    , thread( *this, "EOOS Worker" )
+    , routine_( NULLPTR )
+    , identity_() {
+}
+
+template <int32_t N, size_t S>
+ThreadWorkers<N,S>::Worker::~Worker()
+{
+}
+
+template <int32_t N, size_t S>
+bool_t ThreadWorkers<N,S>::Worker::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <int32_t N, size_t S>
+void ThreadWorkers<N,S>::Worker::start()
+{
+    if( routine_ != NULLPTR )
+    {
+        // The identity is bound each time as the thread local storage is cleared on the thread start
+        static_cast<void>( identity_.bind() );
+        routine_->start();
+    }
+}
+
+template <int32_t N, size_t S>
+size_t ThreadWorkers<N,S>::Worker::getStackSize() const
+{
+    return S;
+}
+
+template <int32_t N, size_t S>
+void ThreadWorkers<N,S>::Worker::set(api::Runnable& routine, ThreadWorkers const* owner, int32_t index)
+{
+    routine_ = &routine;
+    identity_.set(owner, index);
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_THREADWORKERS_HPP_
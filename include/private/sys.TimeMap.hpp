@@ -0,0 +1,40 @@
+/**
+ * @file      sys.TimeMap.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_TIMEMAP_HPP_
+#define SYS_TIMEMAP_HPP_
+
+#include "sys.Types.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class TimeMap
+ * @brief Map of EOOS times in milliseconds to FreeRTOS ticks.
+ */
+class TimeMap
+{
+
+public:
+
+    /**
+     * @brief Converts milliseconds to the kernel ticks.
+     *
+     * A positive time shorter than one tick is rounded up to one tick,
+     * so a timeout or a delay never turns into a poll.
+     *
+     * @param ms A time in milliseconds.
+     * @return Number of ticks, or zero if the time is not positive.
+     */
+    static ::TickType_t toTicks(int32_t ms);
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_TIMEMAP_HPP_
@@ -0,0 +1,171 @@
+/**
+ * @file      sys.TimerManager.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_TIMERMANAGER_HPP_
+#define SYS_TIMERMANAGER_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.Configuration.hpp"
+#include "sys.TimerResource.hpp"
+#include "sys.TimerWheel.hpp"
+#include "sys.Mutex.hpp"
+#include "lib.ResourceMemory.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class TimerManager.
+ * @brief Software timer sub-system manager.
+ */
+class TimerManager : public NonCopyable<NoAllocator>
+{
+    typedef NonCopyable<NoAllocator> Parent;
+
+public:
+
+    /**
+     * @brief Software timer resource type.
+     */
+    typedef TimerResource<TimerManager> Resource;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param scheduler The operating system scheduler.
+     */
+    TimerManager(Scheduler& scheduler);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~TimerManager();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Creates a new software timer resource.
+     *
+     * @param routine A routine interface whose main method is invoked when the timer expires.
+     * @param period  The timer period in milliseconds.
+     * @param type    The timer type.
+     * @return A new timer resource, or NULLPTR if an error has been occurred.
+     */
+    Resource* create(api::Runnable& routine, int32_t period, Resource::Type type);
+
+    /**
+     * @brief Sets priority of the timer daemon task.
+     *
+     * @note The timer daemon is created by the kernel, thus the priority can be set
+     *       only after the kernel has been started.
+     *
+     * @param priority A EOOS thread priority.
+     * @return True if the priority is set.
+     */
+    bool_t setDaemonPriority(int32_t priority);
+
+    /**
+     * @brief Returns the timer wheel for high-volume timeouts.
+     *
+     * @return The timer wheel.
+     */
+    TimerWheel& getWheel();
+
+    /**
+     * @brief Allocates memory.
+     *
+     * @param size Number of bytes to allocate.
+     * @return Allocated memory address or a null pointer.
+     */
+    static void* allocate(size_t size);
+
+    /**
+     * @brief Frees allocated memory.
+     *
+     * @param ptr Address of allocated memory block or a null pointer.
+     */
+    static void free(void* ptr);
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Initializes the allocator with heap for resource allocation.
+     *
+     * @param resource Heap for resource allocation.
+     * @return True if initialized.
+     */
+    static bool_t initialize(api::Heap* resource);
+
+    /**
+     * @brief Initializes the allocator.
+     */
+    static void deinitialize();
+
+    /**
+     * @struct ResourcePool
+     * @brief Resource memory pool.
+     */
+    struct ResourcePool
+    {
+
+    public:
+
+        /**
+         * @brief Constructor.
+         */
+        ResourcePool();
+
+    private:
+
+        /**
+         * @brief Mutex resource.
+         */
+        Mutex mutex_;
+
+    public:
+
+        /**
+         * @brief Timer memory allocator.
+         */
+        lib::ResourceMemory<Resource, Configuration::NUMBER_OF_TIMERS> memory;
+
+    };
+
+    /**
+     * @brief Heap for resource allocation.
+     */
+    static api::Heap* resource_;
+
+    /**
+     * @brief Resource memory pool.
+     */
+    ResourcePool pool_;
+
+    /**
+     * @brief Timer wheel for high-volume timeouts.
+     */
+    TimerWheel wheel_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_TIMERMANAGER_HPP_
@@ -0,0 +1,393 @@
+/**
+ * @file      sys.TimerResource.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_TIMERRESOURCE_HPP_
+#define SYS_TIMERRESOURCE_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.TimeMap.hpp"
+#include "api.Runnable.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class TimerResource
+ * @brief Software timer resource class.
+ *
+ * The timer routine is executed in context of the FreeRTOS timer daemon task,
+ * therefore the routine shall not block.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class TimerResource : public NonCopyable<A>
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @enum Type
+     * @brief Timer type.
+     */
+    enum Type
+    {
+        TYPE_ONE_SHOT,
+        TYPE_PERIODIC
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @param routine A routine interface whose main method is invoked when the timer expires.
+     * @param period  The timer period in milliseconds.
+     * @param type    This timer type.
+     */
+    TimerResource(api::Runnable& routine, int32_t period, Type type);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~TimerResource();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Starts or restarts this timer.
+     *
+     * @return True if the start command is sent to the timer daemon.
+     */
+    bool_t start();
+
+    /**
+     * @brief Stops this timer.
+     *
+     * @return True if the stop command is sent to the timer daemon.
+     */
+    bool_t stop();
+
+    /**
+     * @brief Starts or restarts this timer from interrupt service routine.
+     *
+     * @return True if the start command is sent to the timer daemon.
+     */
+    bool_t startFromInterrupt();
+
+    /**
+     * @brief Stops this timer from interrupt service routine.
+     *
+     * @return True if the stop command is sent to the timer daemon.
+     */
+    bool_t stopFromInterrupt();
+
+    /**
+     * @brief Test if the contex has to be switched.
+     *
+     * @return True to switch contex.
+     */
+    bool_t hasToSwitchContex() const;
+
+    /**
+     * @brief Sets a new period of this timer and starts it.
+     *
+     * @param period The timer period in milliseconds.
+     * @return True if the command is sent to the timer daemon.
+     */
+    bool_t setPeriod(int32_t period);
+
+    /**
+     * @brief Tests if this timer is started.
+     *
+     * @return True if the timer is active.
+     */
+    bool_t isActive() const;
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Initializes kernel timer resource.
+     *
+     * @return True if initialized sucessfully.
+     */
+    bool_t initialize();
+
+    /**
+     * @brief Deinitializes kernel timer resource.
+     */
+    void deinitialize();
+
+    /**
+     * @brief Calls the timer routine by the timer daemon.
+     *
+     * @param xTimer The expired timer.
+     */
+    static void callback(::TimerHandle_t xTimer);
+
+    /**
+     * @brief Gives a semaphore by the timer daemon.
+     *
+     * @param pvParameter1 The semaphore to give.
+     * @param ulParameter2 Unused.
+     */
+    static void release(void* pvParameter1, uint32_t ulParameter2);
+
+    /**
+     * @brief Number of ticks to wait for the timer command queue.
+     */
+    static const ::TickType_t COMMAND_TICKS = 0;
+
+    /**
+     * @brief User routine.
+     */
+    api::Runnable* routine_;
+
+    /**
+     * @brief Timer period in ticks.
+     */
+    ::TickType_t period_;
+
+    /**
+     * @brief Timer type.
+     */
+    Type type_;
+
+    /**
+     * @brief Timer FreeRTOS resource.
+     */
+    ::TimerHandle_t timer_;
+
+    /**
+     * @brief Timer FreeRTOS statatic buffer.
+     */
+    ::StaticTimer_t buffer_;
+
+    /**
+     * @brief Higher priority task woken flag.
+     *
+     * The startFromInterrupt() and stopFromInterrupt() functions will set
+     * the variable to pdTRUE if sending the command caused the timer daemon task
+     * to unblock, and the daemon has a priority higher than the currently
+     * running task. In this case a context switch should be requested before
+     * the interrupt is exited by checking the hasToSwitchContex() function.
+     */
+    ::BaseType_t xHigherPriorityTaskWoken_;
+
+};
+
+template <class A>
+TimerResource<A>::TimerResource(api::Runnable& routine, int32_t period, Type type)
+    : NonCopyable<A>()
+    , routine_( &routine )
+    , period_( TimeMap::toTicks(period) )
+    , type_( type )
+    , timer_( NULL )
+    , buffer_()
+    , xHigherPriorityTaskWoken_( pdFALSE ) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+TimerResource<A>::~TimerResource()
+{
+    deinitialize();
+}
+
+template <class A>
+bool_t TimerResource<A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t TimerResource<A>::start()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        ::BaseType_t const isSent( ::xTimerStart(timer_, COMMAND_TICKS) );
+        res = (isSent == pdPASS) ? true : false;
+    }
+    return res;
+}
+
+template <class A>
+bool_t TimerResource<A>::stop()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        ::BaseType_t const isSent( ::xTimerStop(timer_, COMMAND_TICKS) );
+        res = (isSent == pdPASS) ? true : false;
+    }
+    return res;
+}
+
+template <class A>
+bool_t TimerResource<A>::startFromInterrupt()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        xHigherPriorityTaskWoken_ = pdFALSE;
+        ::BaseType_t const isSent( ::xTimerStartFromISR(timer_, &xHigherPriorityTaskWoken_) );
+        res = (isSent == pdPASS) ? true : false;
+    }
+    return res;
+}
+
+template <class A>
+bool_t TimerResource<A>::stopFromInterrupt()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        xHigherPriorityTaskWoken_ = pdFALSE;
+        ::BaseType_t const isSent( ::xTimerStopFromISR(timer_, &xHigherPriorityTaskWoken_) );
+        res = (isSent == pdPASS) ? true : false;
+    }
+    return res;
+}
+
+template <class A>
+bool_t TimerResource<A>::hasToSwitchContex() const
+{
+    return xHigherPriorityTaskWoken_ != pdFALSE;
+}
+
+template <class A>
+bool_t TimerResource<A>::setPeriod(int32_t period)
+{
+    bool_t res( false );
+    ::TickType_t const ticks( TimeMap::toTicks(period) );
+    if( isConstructed() && (ticks != 0) )
+    {
+        ::BaseType_t const isSent( ::xTimerChangePeriod(timer_, ticks, COMMAND_TICKS) );
+        if( isSent == pdPASS )
+        {
+            period_ = ticks;
+            res = true;
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t TimerResource<A>::isActive() const
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = ::xTimerIsTimerActive(timer_) != pdFALSE;
+    }
+    return res;
+}
+
+template <class A>
+bool_t TimerResource<A>::construct()
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {   ///< UT Justified Branch: HW dependency
+            break;
+        }
+        if( routine_ == NULLPTR )
+        {   ///< UT Justified Branch: SW dependency
+            break;
+        }
+        if( !routine_->isConstructed() )
+        {
+            break;
+        }
+        if( period_ == 0 )
+        {
+            break;
+        }
+        if( !initialize() )
+        {
+            break;
+        }
+        res = true;
+    } while(false);
+    return res;
+}
+
+template <class A>
+bool_t TimerResource<A>::initialize()
+{
+    ::UBaseType_t const uxAutoReload( (type_ == TYPE_PERIODIC) ? pdTRUE : pdFALSE );
+    timer_ = ::xTimerCreateStatic("EOOS Timer", period_, uxAutoReload, this, callback, &buffer_);
+    return timer_ != NULL;
+}
+
+template <class A>
+void TimerResource<A>::deinitialize()
+{
+    if( timer_ != NULL )
+    {
+        ::BaseType_t const isDeleted( ::xTimerDelete(timer_, portMAX_DELAY) );
+        // The timer buffer is used by the timer daemon until the delete command
+        // is processed. Thus, wait for the daemon passes through the command queue
+        // if this is called by a task other than the timer daemon.
+        if( (isDeleted == pdPASS)
+         && (::xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
+         && (::xTaskGetCurrentTaskHandle() != ::xTimerGetTimerDaemonTaskHandle()) )
+        {
+            ::StaticSemaphore_t buffer;
+            ::SemaphoreHandle_t const sem( ::xSemaphoreCreateBinaryStatic(&buffer) );
+            if( sem != NULL )
+            {
+                ::BaseType_t const isPended( ::xTimerPendFunctionCall(release, sem, 0, portMAX_DELAY) );
+                if( isPended == pdPASS )
+                {
+                    static_cast<void>( ::xSemaphoreTake(sem, portMAX_DELAY) );
+                }
+                ::vSemaphoreDelete(sem);
+            }
+        }
+        timer_ = NULL;
+    }
+}
+
+template <class A>
+void TimerResource<A>::callback(::TimerHandle_t xTimer)
+{
+    TimerResource* const timer( reinterpret_cast<TimerResource*>( ::pvTimerGetTimerID(xTimer) ) );
+    if( timer != NULLPTR )
+    {
+        timer->routine_->start();
+    }
+}
+
+template <class A>
+void TimerResource<A>::release(void* pvParameter1, uint32_t ulParameter2)
+{
+    static_cast<void>(ulParameter2); // Avoid MISRA-C++:2008 Rule 0–1–3 and AUTOSAR C++14 Rule A0-1-4
+    ::SemaphoreHandle_t const sem( reinterpret_cast<::SemaphoreHandle_t>(pvParameter1) );
+    static_cast<void>( ::xSemaphoreGive(sem) );
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_TIMERRESOURCE_HPP_
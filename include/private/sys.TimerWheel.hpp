@@ -0,0 +1,280 @@
+/**
+ * @file      sys.TimerWheel.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_TIMERWHEEL_HPP_
+#define SYS_TIMERWHEEL_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.Configuration.hpp"
+#include "api.Runnable.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+class Scheduler;
+
+/**
+ * @class TimerWheel
+ * @brief Hashed timer wheel for high-volume timeouts.
+ *
+ * The wheel is advanced by the system tick interrupt. Scheduling and cancelling
+ * a timeout take constant time. The interrupt only counts the wheel time and
+ * pends the FreeRTOS timer daemon task if the reached slot is not empty. The daemon
+ * walks the slots the time has passed, taking one timeout per critical section,
+ * and calls the routines of expired timeouts in a batch, therefore the routines
+ * shall not block.
+ */
+class TimerWheel : public NonCopyable<NoAllocator>, public api::Runnable
+{
+    typedef NonCopyable<NoAllocator> Parent;
+
+    /**
+     * @struct Link
+     * @brief Link of a circular doubly linked list.
+     */
+    struct Link
+    {
+        /**
+         * @brief Constructor.
+         */
+        Link();
+
+        /**
+         * @brief Next link.
+         */
+        Link* next;
+
+        /**
+         * @brief Previous link.
+         */
+        Link* prev;
+    };
+
+public:
+
+    /**
+     * @class Timeout
+     * @brief Timeout which is scheduled on the wheel.
+     *
+     * The object is owned by a caller and shall not be moved while it is scheduled.
+     */
+    class Timeout : private Link
+    {
+        friend class TimerWheel;
+
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param routine A routine interface whose main method is invoked when the timeout expires.
+         */
+        Timeout(api::Runnable& routine);
+
+        /**
+         * @brief Destructor.
+         */
+        ~Timeout();
+
+        /**
+         * @brief Tests if this timeout is scheduled and has not been dispatched yet.
+         *
+         * @return True if the timeout is pending.
+         */
+        bool_t isPending() const;
+
+    private:
+
+        /**
+         * @brief Copy constructor.
+         */
+        Timeout(Timeout const&);
+
+        /**
+         * @brief Copy assignment operator.
+         */
+        Timeout& operator=(Timeout const&);
+
+        /**
+         * @brief User routine.
+         */
+        api::Runnable* routine_;
+
+        /**
+         * @brief The wheel this timeout is scheduled on.
+         */
+        TimerWheel* wheel_;
+
+        /**
+         * @brief Wheel time of expiration in ticks.
+         */
+        uint32_t due_;
+
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @param scheduler The operating system scheduler whose tick advances the wheel.
+     */
+    TimerWheel(Scheduler& scheduler);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~TimerWheel();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Advances the wheel by one tick.
+     *
+     * @note Called by the system tick interrupt service routine.
+     */
+    virtual void start();
+
+    /**
+     * @brief Schedules or reschedules a timeout.
+     *
+     * @param timeout A timeout to schedule.
+     * @param ms      A time in milliseconds.
+     * @return True if the timeout is scheduled.
+     */
+    bool_t schedule(Timeout& timeout, int32_t ms);
+
+    /**
+     * @brief Schedules or reschedules a timeout from interrupt service routine.
+     *
+     * @param timeout A timeout to schedule.
+     * @param ms      A time in milliseconds.
+     * @return True if the timeout is scheduled.
+     */
+    bool_t scheduleFromInterrupt(Timeout& timeout, int32_t ms);
+
+    /**
+     * @brief Cancels a timeout.
+     *
+     * @param timeout A timeout to cancel.
+     * @return True if the timeout was pending and has been cancelled.
+     */
+    bool_t cancel(Timeout& timeout);
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @param scheduler The operating system scheduler.
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct(Scheduler& scheduler);
+
+    /**
+     * @brief Links a timeout to a wheel slot.
+     *
+     * @note Shall be called in a critical section.
+     *
+     * @param timeout A timeout to link.
+     * @param ticks   A number of ticks to expiration.
+     */
+    void insert(Timeout& timeout, ::TickType_t ticks);
+
+    /**
+     * @brief Processes the slots the wheel time has passed.
+     */
+    void dispatch();
+
+    /**
+     * @brief Dispatches expired timeouts of the slot being processed.
+     *
+     * @param time A wheel time of the slot.
+     */
+    void expire(uint32_t time);
+
+    /**
+     * @brief Dispatches expired timeouts by the timer daemon.
+     *
+     * @param pvParameter1 The timer wheel.
+     * @param ulParameter2 Unused.
+     */
+    static void dispatch(void* pvParameter1, uint32_t ulParameter2);
+
+    /**
+     * @brief Links a link before a list head, thus to the list tail.
+     *
+     * @param head A list head.
+     * @param link A link to add.
+     */
+    static void link(Link& head, Link& link);
+
+    /**
+     * @brief Unlinks a link from its list.
+     *
+     * @param link A link to remove.
+     */
+    static void unlink(Link& link);
+
+    /**
+     * @brief Moves all links of a list before a list head, thus to the list tail.
+     *
+     * @param head A list head.
+     * @param list A list to move.
+     */
+    static void splice(Link& head, Link& list);
+
+    /**
+     * @brief Number of the wheel slots.
+     */
+    static const uint32_t NUMBER_OF_SLOTS = Configuration::TIMER_WHEEL_SLOTS;
+
+    /**
+     * @brief Mask of a slot index.
+     */
+    static const uint32_t SLOT_MASK = NUMBER_OF_SLOTS - 1;
+
+    /**
+     * @brief The operating system scheduler the wheel is hooked to.
+     */
+    Scheduler& scheduler_;
+
+    /**
+     * @brief Wheel time in ticks.
+     */
+    uint32_t now_;
+
+    /**
+     * @brief Wheel time processed by the timer daemon.
+     */
+    uint32_t processed_;
+
+    /**
+     * @brief Dispatching has been pended to the timer daemon.
+     */
+    bool_t isPended_;
+
+    /**
+     * @brief Timeouts of the slot being processed by the timer daemon.
+     */
+    Link scan_;
+
+    /**
+     * @brief The wheel slots.
+     */
+    Link slots_[NUMBER_OF_SLOTS];
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_TIMERWHEEL_HPP_
@@ -0,0 +1,172 @@
+/**
+ * @file      sys.TraceRecorder.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_TRACERECORDER_HPP_
+#define SYS_TRACERECORDER_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.Configuration.hpp"
+#include "sys.Trace.h"
+
+#ifdef EOOS_GLOBAL_SYS_ENABLE_TRACE
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class TraceRecorder
+ * @brief Kernel trace recorder.
+ *
+ * Kernel events are written to a ring buffer of timestamped binary records,
+ * and the oldest records are overwritten when the buffer is full. A record is written
+ * with interrupts masked for a few instructions only, so it can be called from
+ * the kernel critical sections and interrupts. The buffer can be read at runtime
+ * or dumped by a debugger, and converted to the Chrome trace format by
+ * the tools/sys.TraceConverter.py script.
+ */
+class TraceRecorder : public NonCopyable<NoAllocator>
+{
+    typedef NonCopyable<NoAllocator> Parent;
+
+public:
+
+    /**
+     * @struct Record
+     * @brief Trace record.
+     */
+    struct Record
+    {
+        /**
+         * @brief Time in the run time counter units.
+         */
+        uint32_t time;
+
+        /**
+         * @brief Address of a kernel object of the event.
+         */
+        uint32_t object;
+
+        /**
+         * @brief Event identifier.
+         */
+        uint32_t event;
+    };
+
+    /**
+     * @brief Constructor.
+     */
+    TraceRecorder();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~TraceRecorder();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Reads the oldest unread record.
+     *
+     * @param record A record to copy to.
+     * @return True if a record has been read.
+     */
+    bool_t read(Record& record);
+
+    /**
+     * @brief Returns number of records overwritten before they were read.
+     *
+     * @return Number of lost records.
+     */
+    uint32_t getLost() const;
+
+    /**
+     * @brief Copies the last written records of the system trace recorder.
+     *
+     * The records are not marked as read, and the function can be called with interrupts disabled.
+     *
+     * @param records An array for the records from the oldest one.
+     * @param size    Number of elements of the array.
+     * @return Number of copied records.
+     */
+    static uint32_t getLast(Record records[], uint32_t size);
+
+    /**
+     * @brief Records a kernel event to the system trace recorder.
+     *
+     * @param event  An event identifier.
+     * @param object A kernel object of the event.
+     */
+    static void record(uint32_t event, void const* object);
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Writes a record.
+     *
+     * @param event  An event identifier.
+     * @param object A kernel object of the event.
+     */
+    void write(uint32_t event, void const* object);
+
+    /**
+     * @brief Returns current time.
+     *
+     * @return Time in the run time counter units.
+     */
+    static uint32_t getTime();
+
+    /**
+     * @brief Number of records in the buffer.
+     */
+    static const uint32_t NUMBER_OF_RECORDS = Configuration::TRACE_RECORDS;
+
+    /**
+     * @brief The system trace recorder.
+     */
+    static TraceRecorder* recorder_;
+
+    /**
+     * @brief Number of written records.
+     */
+    uint32_t head_;
+
+    /**
+     * @brief Number of read or lost records.
+     */
+    uint32_t tail_;
+
+    /**
+     * @brief Number of lost records.
+     */
+    uint32_t lost_;
+
+    /**
+     * @brief The ring buffer.
+     */
+    Record buffer_[NUMBER_OF_RECORDS];
+
+};
+
+} // namespace sys
+} // namespace eoos
+
+#endif // EOOS_GLOBAL_SYS_ENABLE_TRACE
+#endif // SYS_TRACERECORDER_HPP_
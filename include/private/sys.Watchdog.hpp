@@ -0,0 +1,277 @@
+/**
+ * @file      sys.Watchdog.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_WATCHDOG_HPP_
+#define SYS_WATCHDOG_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.Configuration.hpp"
+#include "sys.ThreadResource.hpp"
+#include "api.Task.hpp"
+
+#ifdef EOOS_GLOBAL_SYS_ENABLE_WATCHDOG
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Watchdog
+ * @brief Software watchdog of thread heartbeats.
+ *
+ * Threads register heartbeats and beat them within their timeouts. A supervisor
+ * thread of the maximum priority checks the heartbeats each watchdog period.
+ * If a heartbeat is missed, the supervisor captures diagnostics of the live threads,
+ * calls a hook which may reset the system, and terminates the system with
+ * ERROR_WATCHDOG if the hook returns.
+ */
+class Watchdog : public NonCopyable<NoAllocator>, public api::Task
+{
+    typedef NonCopyable<NoAllocator> Parent;
+
+public:
+
+    /**
+     * @class Heartbeat
+     * @brief Heartbeat of a thread.
+     */
+    class Heartbeat : public NonCopyable<NoAllocator>
+    {
+        typedef NonCopyable<NoAllocator> Parent;
+
+        friend class Watchdog;
+
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param timeout Time in milliseconds the heartbeat shall be beaten within.
+         */
+        Heartbeat(int32_t timeout);
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~Heartbeat();
+
+        /**
+         * @copydoc eoos::api::Object::isConstructed()
+         */
+        virtual bool_t isConstructed() const;
+
+        /**
+         * @brief Signals the thread is alive.
+         */
+        void beat();
+
+    protected:
+
+        using Parent::setConstructed;
+
+    private:
+
+        /**
+         * @brief Timeout in ticks.
+         */
+        ::TickType_t timeout_;
+
+        /**
+         * @brief Time of the last beat.
+         */
+        ::TickType_t last_;
+
+        /**
+         * @brief The thread FreeRTOS task.
+         */
+        ::TaskHandle_t task_;
+
+        /**
+         * @brief The watchdog the heartbeat is registered in.
+         */
+        Watchdog* watchdog_;
+
+        /**
+         * @brief Next heartbeat.
+         */
+        Heartbeat* next_;
+
+    };
+
+    /**
+     * @struct Record
+     * @brief State of a thread captured on a failure.
+     */
+    struct Record
+    {
+        /**
+         * @brief The thread FreeRTOS task.
+         */
+        ::TaskHandle_t task;
+
+        /**
+         * @brief The thread name.
+         */
+        char_t name[configMAX_TASK_NAME_LEN];
+
+        /**
+         * @brief The FreeRTOS task state.
+         */
+        ::eTaskState state;
+
+        /**
+         * @brief The FreeRTOS task priority.
+         */
+        ::UBaseType_t priority;
+
+        /**
+         * @brief Minimum amount of free stack space in words since the task started.
+         */
+        ::UBaseType_t watermark;
+    };
+
+    /**
+     * @struct Diagnostics
+     * @brief Diagnostics captured on a failure.
+     */
+    struct Diagnostics
+    {
+        /**
+         * @brief FreeRTOS task of the missed heartbeat, or NULL if no failures.
+         */
+        ::TaskHandle_t task;
+
+        /**
+         * @brief Time of the failure.
+         */
+        ::TickType_t time;
+
+        /**
+         * @brief Number of captured thread records.
+         */
+        int32_t number;
+
+        /**
+         * @brief Thread records.
+         */
+        Record records[Configuration::NUMBER_OF_WATCHDOG_RECORDS];
+    };
+
+    /**
+     * @brief Constructor.
+     */
+    Watchdog();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Watchdog();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @copydoc eoos::api::Task::getStackSize()
+     */
+    virtual size_t getStackSize() const;
+
+    /**
+     * @brief Registers a heartbeat of the calling thread.
+     *
+     * @param heartbeat A heartbeat.
+     * @return True if registered.
+     */
+    bool_t add(Heartbeat& heartbeat);
+
+    /**
+     * @brief Unregisters a heartbeat.
+     *
+     * @param heartbeat A heartbeat.
+     * @return True if unregistered.
+     */
+    bool_t remove(Heartbeat& heartbeat);
+
+    /**
+     * @brief Sets a hook called by the supervisor after diagnostics are captured.
+     *
+     * @param hook A routine which may reset the system, or NULLPTR to remove the hook.
+     */
+    void setHook(api::Runnable* hook);
+
+    /**
+     * @brief Returns diagnostics captured on a failure.
+     *
+     * @return The diagnostics.
+     */
+    Diagnostics const& getDiagnostics() const;
+
+private:
+
+    /**
+     * @copydoc eoos::api::Runnable::start()
+     */
+    virtual void start();
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Executes the supervisor thread if it is not executed yet.
+     *
+     * @return True if the thread is executed.
+     */
+    bool_t activate();
+
+    /**
+     * @brief Captures diagnostics of live threads.
+     *
+     * @param task FreeRTOS task of the missed heartbeat.
+     */
+    void capture(::TaskHandle_t task);
+
+    /**
+     * @brief Supervisor period in ticks.
+     */
+    ::TickType_t period_;
+
+    /**
+     * @brief Registered heartbeats.
+     */
+    Heartbeat* head_;
+
+    /**
+     * @brief Hook on a failure.
+     */
+    api::Runnable* hook_;
+
+    /**
+     * @brief Captured diagnostics.
+     */
+    Diagnostics diagnostics_;
+
+    /**
+     * @brief Supervisor thread.
+     */
+    ThreadResource<NoAllocator> thread_;
+
+    /**
+     * @brief The supervisor thread is executed flag.
+     */
+    bool_t isActive_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+
+#endif // EOOS_GLOBAL_SYS_ENABLE_WATCHDOG
+#endif // SYS_WATCHDOG_HPP_
@@ -0,0 +1,684 @@
+/**
+ * @file      sys.WorkStealingPoolResource.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_WORKSTEALINGPOOLRESOURCE_HPP_
+#define SYS_WORKSTEALINGPOOLRESOURCE_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.ThreadWorkers.hpp"
+#include "api.Runnable.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class WorkStealingPoolResource
+ * @brief Work-stealing thread pool resource class.
+ *
+ * Each worker thread has its own deque of jobs. A worker pushes and pops
+ * the jobs it forks at the bottom of its deque, and an idle worker steals
+ * the oldest jobs from the top of other deques. On SMP FreeRTOS the workers
+ * of one priority are spread over the cores by the kernel, thus a job split
+ * into small forked jobs is balanced between the cores without partitioning.
+ *
+ * A counting semaphore counts the jobs of all the deques, therefore a worker
+ * which has taken the semaphore always finds a job in one of the deques.
+ * The last finished job of a group gives the group semaphore, which is the only
+ * signal of the group completion, and a join always takes it.
+ *
+ * @tparam A Heap memory allocator class.
+ * @tparam N Number of worker threads.
+ * @tparam L Maximum number of jobs of one worker deque.
+ * @tparam S Stack size of worker threads in Bytes aligned to 8.
+ */
+template <class A, int32_t N, uint32_t L, size_t S>
+class WorkStealingPoolResource : public NonCopyable<A>
+{
+    typedef NonCopyable<A> Parent;
+
+    EOOS_SYS_STATIC_ASSERT(L > 0, "Work-stealing pool shall have deques");
+
+public:
+
+    /**
+     * @class Group
+     * @brief Group of forked jobs to be joined.
+     */
+    class Group : public NonCopyable<NoAllocator>
+    {
+        typedef NonCopyable<NoAllocator> Parent;
+
+        friend class WorkStealingPoolResource;
+
+    public:
+
+        /**
+         * @brief Constructor.
+         */
+        Group();
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~Group();
+
+        /**
+         * @copydoc eoos::api::Object::isConstructed()
+         */
+        virtual bool_t isConstructed() const;
+
+    protected:
+
+        using Parent::setConstructed;
+
+    private:
+
+        /**
+         * @brief Constructs this object.
+         *
+         * @return True if object has been constructed successfully.
+         */
+        bool_t construct();
+
+        /**
+         * @brief Number of not finished jobs.
+         */
+        int32_t count_;
+
+        /**
+         * @brief Jobs have been forked since the last join flag.
+         */
+        bool_t isForked_;
+
+        /**
+         * @brief Semaphore given when all jobs are finished.
+         */
+        ::SemaphoreHandle_t done_;
+
+        /**
+         * @brief Semaphore FreeRTOS statatic buffer.
+         */
+        ::StaticSemaphore_t buffer_;
+
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @param priority A priority of worker threads.
+     */
+    WorkStealingPoolResource(int32_t priority);
+
+    /**
+     * @brief Destructor.
+     *
+     * @note The pool shall not be destroyed by its worker thread.
+     */
+    virtual ~WorkStealingPoolResource();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Submits a job to be executed by a worker thread.
+     *
+     * The job is pushed to the deques in turn, and to the next one if a deque is full.
+     *
+     * @param job A job whose main method is invoked by a worker thread.
+     * @return True if the job is queued.
+     */
+    bool_t submit(api::Runnable& job);
+
+    /**
+     * @brief Forks a job of a group.
+     *
+     * If called by a worker thread, the job is pushed to the worker deque,
+     * or to other deques if the worker deque is full. The forked jobs of
+     * a group shall be joined before the group is forked again.
+     *
+     * @param group A group of the job.
+     * @param job   A job whose main method is invoked by a worker thread.
+     * @return True if the job is queued.
+     */
+    bool_t fork(Group& group, api::Runnable& job);
+
+    /**
+     * @brief Waits for all forked jobs of a group are finished.
+     *
+     * If called by a worker thread, the thread executes jobs while there are ones
+     * in the deques, and then blocks till the last job of the group is finished.
+     *
+     * @param group A group of jobs.
+     * @return True if all jobs are finished.
+     */
+    bool_t join(Group& group);
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @struct Item
+     * @brief Item of a deque.
+     */
+    struct Item
+    {
+        /**
+         * @brief The job.
+         */
+        api::Runnable* job;
+
+        /**
+         * @brief The group of the job or NULLPTR.
+         */
+        Group* group;
+    };
+
+    /**
+     * @class Routine
+     * @brief Routine of worker threads.
+     */
+    class Routine : public NonCopyable<NoAllocator>, public api::Runnable
+    {
+        typedef NonCopyable<NoAllocator> Parent;
+
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param pool The pool.
+         */
+        Routine(WorkStealingPoolResource& pool);
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~Routine();
+
+        /**
+         * @copydoc eoos::api::Object::isConstructed()
+         */
+        virtual bool_t isConstructed() const;
+
+        /**
+         * @copydoc eoos::api::Runnable::start()
+         */
+        virtual void start();
+
+    private:
+
+        /**
+         * @brief The pool.
+         */
+        WorkStealingPoolResource& pool_;
+
+    };
+
+    /**
+     * @struct Deque
+     * @brief Deque of jobs of a worker thread.
+     */
+    struct Deque
+    {
+        /**
+         * @brief Constructor.
+         */
+        Deque();
+
+        /**
+         * @brief Jobs.
+         */
+        Item items[L];
+
+        /**
+         * @brief Index of the oldest job.
+         */
+        uint32_t top;
+
+        /**
+         * @brief Index after the newest job.
+         */
+        uint32_t bottom;
+    };
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @param priority A priority of worker threads.
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct(int32_t priority);
+
+    /**
+     * @brief Initializes the jobs semaphore.
+     *
+     * @return True if initialized sucessfully.
+     */
+    bool_t initialize();
+
+    /**
+     * @brief Terminates the worker threads and deletes the jobs semaphore.
+     */
+    void deinitialize();
+
+    /**
+     * @brief Pushes a job to a deque.
+     *
+     * @param job   A job.
+     * @param group A group of the job or NULLPTR.
+     * @return True if the job is pushed.
+     */
+    bool_t push(api::Runnable& job, Group* group);
+
+    /**
+     * @brief Takes a job from the own deque, or steals it from other deques.
+     *
+     * @param index An index of the calling worker.
+     * @param item  An item for the job.
+     * @return True if a job is taken.
+     */
+    bool_t take(int32_t index, Item& item);
+
+    /**
+     * @brief Executes a job.
+     *
+     * @param item A job item.
+     */
+    static void run(Item& item);
+
+    /**
+     * @brief Counts a job of a group finished, and signals the group completion on the last one.
+     *
+     * @param group A group.
+     */
+    static void finish(Group& group);
+
+    /**
+     * @brief Routine of worker threads.
+     */
+    Routine routine_;
+
+    /**
+     * @brief Worker threads.
+     */
+    ThreadWorkers<N,S> workers_;
+
+    /**
+     * @brief Deques of the worker threads.
+     */
+    Deque deques_[N];
+
+    /**
+     * @brief Index of a deque for jobs submitted by not workers.
+     */
+    int32_t next_;
+
+    /**
+     * @brief Stop request for worker threads.
+     */
+    bool_t isStopped_;
+
+    /**
+     * @brief Semaphore which counts jobs of all deques.
+     */
+    ::SemaphoreHandle_t jobs_;
+
+    /**
+     * @brief Semaphore FreeRTOS statatic buffer.
+     */
+    ::StaticSemaphore_t buffer_;
+
+};
+
+template <class A, int32_t N, uint32_t L, size_t S>
+WorkStealingPoolResource<A,N,L,S>::WorkStealingPoolResource(int32_t priority)
+    : NonCopyable<A>()
+    , routine_( *this )
+    , workers_( routine_ )
+    , deques_()
+    , next_( 0 )
+    , isStopped_( false )
+    , jobs_( NULL )
+    , buffer_() {
+    bool_t const isConstructed( construct(priority) );
+    setConstructed( isConstructed );
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+WorkStealingPoolResource<A,N,L,S>::~WorkStealingPoolResource()
+{
+    deinitialize();
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+bool_t WorkStealingPoolResource<A,N,L,S>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+bool_t WorkStealingPoolResource<A,N,L,S>::submit(api::Runnable& job)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = push(job, NULLPTR);
+    }
+    return res;
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+bool_t WorkStealingPoolResource<A,N,L,S>::fork(Group& group, api::Runnable& job)
+{
+    bool_t res( false );
+    if( isConstructed() && group.isConstructed() )
+    {
+        taskENTER_CRITICAL();
+        group.count_++;
+        group.isForked_ = true;
+        taskEXIT_CRITICAL();
+        res = push(job, &group);
+        if( !res )
+        {
+            // The group completion is signaled if the other jobs have been finished
+            finish(group);
+        }
+    }
+    return res;
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+bool_t WorkStealingPoolResource<A,N,L,S>::join(Group& group)
+{
+    bool_t res( false );
+    if( isConstructed() && group.isConstructed() )
+    {
+        if( group.isForked_ )
+        {
+            int32_t const index( workers_.getIndex() );
+            bool_t isDone( false );
+            while( !isDone )
+            {
+                if( ::xSemaphoreTake(group.done_, 0) == pdPASS )
+                {
+                    isDone = true;
+                }
+                else if( (index >= 0) && (::xSemaphoreTake(jobs_, 0) == pdPASS) )
+                {
+                    // Help other workers instead of blocking this worker
+                    Item item;
+                    if( take(index, item) )
+                    {
+                        run(item);
+                    }
+                }
+                else
+                {
+                    // The not finished jobs are executed by other threads, and the last one gives the signal
+                    isDone = ::xSemaphoreTake(group.done_, portMAX_DELAY) == pdPASS;
+                }
+            }
+            group.isForked_ = false;
+        }
+        res = true;
+    }
+    return res;
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+bool_t WorkStealingPoolResource<A,N,L,S>::construct(int32_t priority)
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {   ///< UT Justified Branch: HW dependency
+            break;
+        }
+        // A worker identifies itself to use its own deque
+        if( !ThreadWorker::isAvailable() )
+        {
+            break;
+        }
+        if( !routine_.isConstructed() )
+        {
+            break;
+        }
+        if( !workers_.isConstructed() )
+        {
+            break;
+        }
+        if( !initialize() )
+        {
+            break;
+        }
+        if( !workers_.execute(priority) )
+        {
+            break;
+        }
+        res = true;
+    } while(false);
+    return res;
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+bool_t WorkStealingPoolResource<A,N,L,S>::initialize()
+{
+    ::UBaseType_t const uxMaxCount( static_cast<::UBaseType_t>(N) * static_cast<::UBaseType_t>(L + 1U) );
+    jobs_ = ::xSemaphoreCreateCountingStatic(uxMaxCount, 0, &buffer_);
+    return jobs_ != NULL;
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+void WorkStealingPoolResource<A,N,L,S>::deinitialize()
+{
+    if( jobs_ != NULL )
+    {
+        // Each worker thread terminates when it finds no jobs after the stop request
+        isStopped_ = true;
+        for(int32_t i( 0 ); i < workers_.getNumber(); i++)
+        {
+            static_cast<void>( ::xSemaphoreGive(jobs_) );
+        }
+        workers_.join();
+        ::vSemaphoreDelete(jobs_);
+        jobs_ = NULL;
+    }
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+bool_t WorkStealingPoolResource<A,N,L,S>::push(api::Runnable& job, Group* group)
+{
+    bool_t res( false );
+    int32_t index( workers_.getIndex() );
+    taskENTER_CRITICAL();
+    if( index < 0 )
+    {
+        index = next_;
+        next_ = (next_ + 1) % N;
+    }
+    for(int32_t i( 0 ); i < N; i++)
+    {
+        Deque& deque( deques_[(index + i) % N] );
+        if( (deque.bottom - deque.top) < L )
+        {
+            Item& item( deque.items[deque.bottom % L] );
+            item.job = &job;
+            item.group = group;
+            deque.bottom++;
+            res = true;
+            break;
+        }
+    }
+    taskEXIT_CRITICAL();
+    if( res )
+    {
+        static_cast<void>( ::xSemaphoreGive(jobs_) );
+    }
+    return res;
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+bool_t WorkStealingPoolResource<A,N,L,S>::take(int32_t index, Item& item)
+{
+    bool_t res( false );
+    taskENTER_CRITICAL();
+    Deque& own( deques_[index] );
+    if( own.bottom != own.top )
+    {
+        own.bottom--;
+        item = own.items[own.bottom % L];
+        res = true;
+    }
+    else
+    {
+        for(int32_t i( 1 ); i < N; i++)
+        {
+            Deque& victim( deques_[(index + i) % N] );
+            if( victim.bottom != victim.top )
+            {
+                item = victim.items[victim.top % L];
+                victim.top++;
+                res = true;
+                break;
+            }
+        }
+    }
+    taskEXIT_CRITICAL();
+    return res;
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+void WorkStealingPoolResource<A,N,L,S>::run(Item& item)
+{
+    item.job->start();
+    if( item.group != NULLPTR )
+    {
+        finish(*item.group);
+    }
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+void WorkStealingPoolResource<A,N,L,S>::finish(Group& group)
+{
+    taskENTER_CRITICAL();
+    group.count_--;
+    bool_t const isDone( group.count_ == 0 );
+    ::SemaphoreHandle_t const done( group.done_ );
+    taskEXIT_CRITICAL();
+    if( isDone )
+    {
+        // The joining thread may destroy the group after the signal, thus it is the last access
+        static_cast<void>( ::xSemaphoreGive(done) );
+    }
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+WorkStealingPoolResource<A,N,L,S>::Group::Group()
+    : NonCopyable<NoAllocator>()
+    , count_( 0 )
+    , isForked_( false )
+    , done_( NULL )
+    , buffer_() {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+WorkStealingPoolResource<A,N,L,S>::Group::~Group()
+{
+    if( done_ != NULL )
+    {
+        ::vSemaphoreDelete(done_);
+        done_ = NULL;
+    }
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+bool_t WorkStealingPoolResource<A,N,L,S>::Group::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+bool_t WorkStealingPoolResource<A,N,L,S>::Group::construct()
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {   ///< UT Justified Branch: HW dependency
+            break;
+        }
+        done_ = ::xSemaphoreCreateBinaryStatic(&buffer_);
+        if( done_ == NULL )
+        {
+            break;
+        }
+        res = true;
+    } while(false);
+    return res;
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+WorkStealingPoolResource<A,N,L,S>::Routine::Routine(WorkStealingPoolResource& pool)
+    : NonCopyable<NoAllocator>()
+    , api::Runnable()
+    , pool_( pool ) {
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+WorkStealingPoolResource<A,N,L,S>::Routine::~Routine()
+{
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+bool_t WorkStealingPoolResource<A,N,L,S>::Routine::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+void WorkStealingPoolResource<A,N,L,S>::Routine::start()
+{
+    int32_t const index( pool_.workers_.getIndex() );
+    while( index >= 0 )
+    {
+        if( ::xSemaphoreTake(pool_.jobs_, portMAX_DELAY) != pdPASS )
+        {
+            continue;
+        }
+        Item item;
+        if( pool_.take(index, item) )
+        {
+            run(item);
+        }
+        else if( pool_.isStopped_ )
+        {
+            break;
+        }
+        else
+        {
+        }
+    }
+}
+
+template <class A, int32_t N, uint32_t L, size_t S>
+WorkStealingPoolResource<A,N,L,S>::Deque::Deque()
+    : items()
+    , top( 0 )
+    , bottom( 0 ) {
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_WORKSTEALINGPOOLRESOURCE_HPP_
@@ -0,0 +1,24 @@
+/**
+ * @file      sys.ConditionVariable.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_CONDITIONVARIABLE_HPP_
+#define SYS_CONDITIONVARIABLE_HPP_
+
+#include "sys.ConditionVariableResource.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ConditionVariable
+ * @brief System condition variable for called by protected software components.
+ */
+typedef ConditionVariableResource<NoAllocator> ConditionVariable;
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_CONDITIONVARIABLE_HPP_
@@ -0,0 +1,181 @@
+/**
+ * @file      sys.Coroutine.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_COROUTINE_HPP_
+#define SYS_COROUTINE_HPP_
+
+#include "sys.NonCopyable.hpp"
+
+/**
+ * @brief Begins a coroutine body in the run() function.
+ */
+#define EOOS_SYS_CO_BEGIN() switch( getLine() ) { case 0:
+
+/**
+ * @brief Yields to other coroutines, and continues on the next pass of the scheduler.
+ */
+#define EOOS_SYS_CO_YIELD() setLine(__LINE__); return STATE_READY; case __LINE__:
+
+/**
+ * @brief Waits for a condition is true, which is tested each time the scheduler is notified.
+ *
+ * @param cond A condition, for example CoroutineSemaphore::acquire().
+ */
+#define EOOS_SYS_CO_AWAIT(cond) setLine(__LINE__); case __LINE__: if( !(cond) ) { return STATE_WAITING; }
+
+/**
+ * @brief Sleeps for a time.
+ *
+ * @param ms A time to sleep in milliseconds.
+ */
+#define EOOS_SYS_CO_SLEEP(ms) setLine(__LINE__); delay(ms); return STATE_WAITING; case __LINE__:
+
+/**
+ * @brief Ends a coroutine body in the run() function.
+ */
+#define EOOS_SYS_CO_END() } setLine(LINE_END); return STATE_DONE;
+
+namespace eoos
+{
+namespace sys
+{
+
+class CoroutineScheduler;
+
+/**
+ * @class Coroutine
+ * @brief Stackless coroutine executed by a coroutine scheduler.
+ *
+ * A coroutine is a protothread: its run() function is resumed from the point
+ * it returned, and all the coroutines of a scheduler share the stack of one
+ * thread. Therefore local variables of run() are not kept between resumptions,
+ * and a state shall be kept in members. For example:
+ *
+ * @code
+ * virtual State run()
+ * {
+ *     EOOS_SYS_CO_BEGIN();
+ *     while( true )
+ *     {
+ *         EOOS_SYS_CO_AWAIT( sem_.acquire() );
+ *         handle();
+ *         EOOS_SYS_CO_SLEEP( 10 );
+ *     }
+ *     EOOS_SYS_CO_END();
+ * }
+ * @endcode
+ *
+ * @note The EOOS_SYS_CO_* macros shall not be used inside a switch statement of run().
+ */
+class Coroutine : public NonCopyable<NoAllocator>
+{
+    typedef NonCopyable<NoAllocator> Parent;
+
+    friend class CoroutineScheduler;
+
+public:
+
+    /**
+     * @enum State
+     * @brief State returned by a coroutine.
+     */
+    enum State
+    {
+        STATE_READY,
+        STATE_WAITING,
+        STATE_DONE
+    };
+
+    /**
+     * @brief Constructor.
+     */
+    Coroutine();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Coroutine();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Resumes this coroutine.
+     *
+     * @return A state of the coroutine.
+     */
+    virtual State run() = 0;
+
+    /**
+     * @brief Tests if this coroutine is done.
+     *
+     * @return True if done.
+     */
+    bool_t isDone() const;
+
+protected:
+
+    using Parent::setConstructed;
+
+    /**
+     * @brief Returns a line to resume.
+     *
+     * @return The line.
+     */
+    int32_t getLine() const;
+
+    /**
+     * @brief Sets a line to resume.
+     *
+     * @param line The line.
+     */
+    void setLine(int32_t line);
+
+    /**
+     * @brief Requests a sleep of this coroutine.
+     *
+     * @param ms A time to sleep in milliseconds.
+     */
+    void delay(int32_t ms);
+
+    /**
+     * @brief Line of a done coroutine.
+     */
+    static const int32_t LINE_END = -1;
+
+private:
+
+    /**
+     * @brief Line to resume.
+     */
+    int32_t line_;
+
+    /**
+     * @brief Tick count the sleep started.
+     */
+    ::TickType_t start_;
+
+    /**
+     * @brief Number of ticks to sleep.
+     */
+    ::TickType_t ticks_;
+
+    /**
+     * @brief Sleep flag.
+     */
+    bool_t isSleeping_;
+
+    /**
+     * @brief Next coroutine of the scheduler.
+     */
+    Coroutine* next_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_COROUTINE_HPP_
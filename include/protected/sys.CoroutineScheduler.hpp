@@ -0,0 +1,125 @@
+/**
+ * @file      sys.CoroutineScheduler.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_COROUTINESCHEDULER_HPP_
+#define SYS_COROUTINESCHEDULER_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.Coroutine.hpp"
+#include "api.Task.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class CoroutineScheduler
+ * @brief Scheduler of coroutines executed by one thread.
+ *
+ * The scheduler is a task of a thread, and it resumes its coroutines in turn
+ * until all of them are done. If no coroutine is ready, the thread blocks on
+ * its task notification until the nearest sleep expires or the scheduler is
+ * notified by an awaited event.
+ */
+class CoroutineScheduler : public NonCopyable<NoAllocator>, public api::Task
+{
+    typedef NonCopyable<NoAllocator> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param stackSize A stack size of the thread in Bytes.
+     */
+    CoroutineScheduler(size_t stackSize);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~CoroutineScheduler();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @copydoc eoos::api::Runnable::start()
+     */
+    virtual void start();
+
+    /**
+     * @copydoc eoos::api::Task::getStackSize()
+     */
+    virtual size_t getStackSize() const;
+
+    /**
+     * @brief Adds a coroutine.
+     *
+     * @note The function shall be called before the scheduler is started, or by its coroutine.
+     *
+     * @param coroutine A coroutine.
+     * @return True if the coroutine is added.
+     */
+    bool_t add(Coroutine& coroutine);
+
+    /**
+     * @brief Wakes up the scheduler to test awaited conditions.
+     */
+    void notify();
+
+    /**
+     * @brief Wakes up the scheduler from interrupt service routine.
+     */
+    void notifyFromInterrupt();
+
+    /**
+     * @brief Test if the contex has to be switched.
+     *
+     * @return True to switch contex.
+     */
+    bool_t hasToSwitchContex() const;
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Resumes all coroutines once.
+     *
+     * @param timeout A number of ticks to the nearest sleep expiration.
+     * @return True if a coroutine is ready.
+     */
+    bool_t resume(::TickType_t& timeout);
+
+    /**
+     * @brief Stack size of the thread.
+     */
+    size_t stackSize_;
+
+    /**
+     * @brief The thread FreeRTOS task.
+     */
+    ::TaskHandle_t task_;
+
+    /**
+     * @brief Coroutines.
+     */
+    Coroutine* head_;
+
+    /**
+     * @brief Higher priority task woken flag.
+     */
+    ::BaseType_t xHigherPriorityTaskWoken_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_COROUTINESCHEDULER_HPP_
@@ -0,0 +1,93 @@
+/**
+ * @file      sys.CoroutineSemaphore.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_COROUTINESEMAPHORE_HPP_
+#define SYS_COROUTINESEMAPHORE_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.CoroutineScheduler.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class CoroutineSemaphore
+ * @brief Counting semaphore awaited by coroutines.
+ *
+ * The semaphore is acquired by coroutines of one scheduler with EOOS_SYS_CO_AWAIT,
+ * and released by any thread or interrupt. A semaphore of no permits serves
+ * as a notification of coroutines.
+ */
+class CoroutineSemaphore : public NonCopyable<NoAllocator>
+{
+    typedef NonCopyable<NoAllocator> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param scheduler A scheduler of coroutines which acquire the semaphore.
+     * @param permits   The initial number of permits available.
+     */
+    CoroutineSemaphore(CoroutineScheduler& scheduler, int32_t permits);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~CoroutineSemaphore();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Acquires a permit if it is available.
+     *
+     * @return True if a permit is acquired.
+     */
+    bool_t acquire();
+
+    /**
+     * @brief Releases a permit.
+     */
+    void release();
+
+    /**
+     * @brief Releases a permit from interrupt service routine.
+     */
+    void releaseFromInterrupt();
+
+    /**
+     * @brief Test if the contex has to be switched.
+     *
+     * @return True to switch contex.
+     */
+    bool_t hasToSwitchContex() const;
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Scheduler of awaiting coroutines.
+     */
+    CoroutineScheduler& scheduler_;
+
+    /**
+     * @brief Number of permits available.
+     */
+    int32_t permits_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_COROUTINESEMAPHORE_HPP_
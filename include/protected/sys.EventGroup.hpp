@@ -0,0 +1,24 @@
+/**
+ * @file      sys.EventGroup.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_EVENTGROUP_HPP_
+#define SYS_EVENTGROUP_HPP_
+
+#include "sys.EventGroupResource.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class EventGroup
+ * @brief System event group for called by protected software components.
+ */
+typedef EventGroupResource<NoAllocator> EventGroup;
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_EVENTGROUP_HPP_
@@ -0,0 +1,151 @@
+/**
+ * @file      sys.Future.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_FUTURE_HPP_
+#define SYS_FUTURE_HPP_
+
+#include "sys.FutureResource.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Promise
+ * @brief System promise for called by protected software components.
+ *
+ * The promise owns the result state, and it is allocated statically or
+ * on a stack of the consumer. A producer sets the result to the promise,
+ * and a consumer gets it through the future of the promise.
+ *
+ * @tparam T Type of the result.
+ */
+template <typename T>
+class Promise : public FutureResource<T,NoAllocator>
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    Promise();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Promise();
+
+};
+
+/**
+ * @class Future
+ * @brief System future for called by protected software components.
+ *
+ * @tparam T Type of the result.
+ */
+template <typename T>
+class Future : public NonCopyable<NoAllocator>
+{
+    typedef NonCopyable<NoAllocator> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param promise A promise of the result.
+     */
+    Future(Promise<T>& promise);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Future();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @copydoc eoos::sys::FutureResource::get(T&)
+     */
+    bool_t get(T& value);
+
+    /**
+     * @copydoc eoos::sys::FutureResource::get(T&,int32_t)
+     */
+    bool_t get(T& value, int32_t ms);
+
+    /**
+     * @copydoc eoos::sys::FutureResource::isReady()
+     */
+    bool_t isReady() const;
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief The promise of the result.
+     */
+    Promise<T>& promise_;
+
+};
+
+template <typename T>
+Promise<T>::Promise()
+    : FutureResource<T,NoAllocator>() {
+}
+
+template <typename T>
+Promise<T>::~Promise()
+{
+}
+
+template <typename T>
+Future<T>::Future(Promise<T>& promise)
+    : NonCopyable<NoAllocator>()
+    , promise_( promise ) {
+    bool_t const isConstructed( promise_.isConstructed() );
+    setConstructed( isConstructed );
+}
+
+template <typename T>
+Future<T>::~Future()
+{
+}
+
+template <typename T>
+bool_t Future<T>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <typename T>
+bool_t Future<T>::get(T& value)
+{
+    return isConstructed() && promise_.get(value);
+}
+
+template <typename T>
+bool_t Future<T>::get(T& value, int32_t ms)
+{
+    return isConstructed() && promise_.get(value, ms);
+}
+
+template <typename T>
+bool_t Future<T>::isReady() const
+{
+    return isConstructed() && promise_.isReady();
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_FUTURE_HPP_
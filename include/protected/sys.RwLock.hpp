@@ -0,0 +1,24 @@
+/**
+ * @file      sys.RwLock.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_RWLOCK_HPP_
+#define SYS_RWLOCK_HPP_
+
+#include "sys.RwLockResource.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class RwLock
+ * @brief System reader-writer lock for called by protected software components.
+ */
+typedef RwLockResource<NoAllocator> RwLock;
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_RWLOCK_HPP_
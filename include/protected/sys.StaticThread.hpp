@@ -0,0 +1,104 @@
+/**
+ * @file      sys.StaticThread.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_STATICTHREAD_HPP_
+#define SYS_STATICTHREAD_HPP_
+
+#include "sys.ThreadResource.hpp"
+#include "sys.StaticThreads.hpp"
+
+/**
+ * @brief Places a static thread object in the static threads linker section.
+ *
+ * @note The section is set by EOOS_GLOBAL_SYS_STATIC_THREAD_SECTION, otherwise the macro is empty.
+ */
+#ifdef EOOS_GLOBAL_SYS_STATIC_THREAD_SECTION
+    #define EOOS_SYS_STATIC_THREAD_PLACEMENT __attribute__(( section(EOOS_GLOBAL_SYS_STATIC_THREAD_SECTION) ))
+#else
+    #define EOOS_SYS_STATIC_THREAD_PLACEMENT
+#endif // EOOS_GLOBAL_SYS_STATIC_THREAD_SECTION
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class StaticThread
+ * @brief Statically declared thread.
+ *
+ * An object of the class shall have static storage duration. It is constructed
+ * on the program start-up with no memory allocation, and it is executed by
+ * the system right before the kernel is started. The placement macro shall
+ * precede the initializer, as GCC ignores attributes after a parenthesized one.
+ * For example:
+ *
+ * @code
+ * static sys::StaticThread<1024, api::Thread::PRIORITY_MAX> thread_ EOOS_SYS_STATIC_THREAD_PLACEMENT (task_, "Control");
+ * @endcode
+ *
+ * @note The constructor checks the task is constructed. Thus, the task shall be defined
+ *       before the thread in the same translation unit, as the initialization order of
+ *       static objects of different translation units is unspecified.
+ *
+ * @tparam S Stack size in Bytes aligned to 8.
+ * @tparam P Priority of the thread.
+ */
+template <size_t S = Configuration::THREAD_STACK_SIZE, int32_t P = api::Thread::PRIORITY_NORM>
+class StaticThread : public ThreadResource<NoAllocator,S>
+{
+    typedef ThreadResource<NoAllocator,S> Parent;
+
+    EOOS_SYS_STATIC_ASSERT(((api::Thread::PRIORITY_MIN <= P) && (P <= api::Thread::PRIORITY_MAX)) || (P == api::Thread::PRIORITY_IDLE), "Static thread priority is wrong");
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param task A task interface whose main method is invoked when this thread is started.
+     * @param name A name of this thread for debug purposes.
+     */
+    StaticThread(api::Task& task, char_t const* name);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~StaticThread();
+
+private:
+
+    /**
+     * @brief Static threads are not allocated by the allocator, thus they cannot be detached.
+     */
+    using Parent::detach;
+
+    /**
+     * @brief Node of the static threads list.
+     */
+    StaticThreads::Node node_;
+
+};
+
+template <size_t S, int32_t P>
+StaticThread<S,P>::StaticThread(api::Task& task, char_t const* name)
+    : ThreadResource<NoAllocator,S>(task, name)
+    , node_( *this ) {
+    if( Parent::isConstructed() )
+    {
+        static_cast<void>( Parent::setPriority(P) );
+        StaticThreads::add(node_);
+    }
+}
+
+template <size_t S, int32_t P>
+StaticThread<S,P>::~StaticThread()
+{
+    StaticThreads::remove(node_);
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_STATICTHREAD_HPP_
@@ -30,11 +30,26 @@ public:
      */
     Thread(api::Task& task);
 
+    /**
+     * @brief Constructor of not constructed object.
+     *
+     * @param task A task interface whose main method is invoked when this thread is started.
+     * @param name A name of this thread for debug purposes.
+     */
+    Thread(api::Task& task, char_t const* name);
+
     /**
      * @brief Destructor.
      */
     virtual ~Thread();
     
+    /**
+     * @brief Returns the currently running thread.
+     *
+     * @return The thread, or NULLPTR if the caller is not an EOOS thread.
+     */
+    static api::Thread* getCurrent();
+
     /**
      * @copydoc eoos::api::Scheduler::sleep(int32_t)
      */
@@ -50,6 +65,13 @@ public:
      */
     static void yieldFromInterrupt();
 
+private:
+
+    /**
+     * @brief Threads of the class are not allocated by the allocator, thus they cannot be detached.
+     */
+    using Parent::detach;
+
 };
 
 
@@ -0,0 +1,52 @@
+/**
+ * @file      sys.ThreadLocal.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_THREADLOCAL_HPP_
+#define SYS_THREADLOCAL_HPP_
+
+#include "sys.ThreadLocalResource.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ThreadLocal
+ * @brief System thread local variable for called by protected software components.
+ *
+ * @tparam T Type of values.
+ */
+template <typename T>
+class ThreadLocal : public ThreadLocalResource<T,NoAllocator>
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    ThreadLocal();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~ThreadLocal();
+
+};
+
+template <typename T>
+ThreadLocal<T>::ThreadLocal()
+    : ThreadLocalResource<T,NoAllocator>() {
+}
+
+template <typename T>
+ThreadLocal<T>::~ThreadLocal()
+{
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_THREADLOCAL_HPP_
@@ -0,0 +1,56 @@
+/**
+ * @file      sys.ThreadPool.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_THREADPOOL_HPP_
+#define SYS_THREADPOOL_HPP_
+
+#include "sys.ThreadPoolResource.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ThreadPool
+ * @brief System thread pool for called by protected software components.
+ *
+ * @tparam N Number of worker threads.
+ * @tparam L Maximum number of pending jobs.
+ * @tparam S Stack size of worker threads in Bytes aligned to 8.
+ */
+template <int32_t N, uint32_t L, size_t S = Configuration::THREAD_STACK_SIZE>
+class ThreadPool : public ThreadPoolResource<NoAllocator,N,L,S>
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param priority A priority of worker threads.
+     */
+    ThreadPool(int32_t priority);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~ThreadPool();
+
+};
+
+template <int32_t N, uint32_t L, size_t S>
+ThreadPool<N,L,S>::ThreadPool(int32_t priority)
+    : ThreadPoolResource<NoAllocator,N,L,S>(priority) {
+}
+
+template <int32_t N, uint32_t L, size_t S>
+ThreadPool<N,L,S>::~ThreadPool()
+{
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_THREADPOOL_HPP_
@@ -0,0 +1,24 @@
+/**
+ * @file      sys.Timer.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_TIMER_HPP_
+#define SYS_TIMER_HPP_
+
+#include "sys.TimerResource.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Timer
+ * @brief System software timer for called by protected software components.
+ */
+typedef TimerResource<NoAllocator> Timer;
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_TIMER_HPP_
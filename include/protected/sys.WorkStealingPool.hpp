@@ -0,0 +1,56 @@
+/**
+ * @file      sys.WorkStealingPool.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_WORKSTEALINGPOOL_HPP_
+#define SYS_WORKSTEALINGPOOL_HPP_
+
+#include "sys.WorkStealingPoolResource.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class WorkStealingPool
+ * @brief System work-stealing thread pool for called by protected software components.
+ *
+ * @tparam N Number of worker threads, usually the number of cores.
+ * @tparam L Maximum number of jobs of one worker deque.
+ * @tparam S Stack size of worker threads in Bytes aligned to 8.
+ */
+template <int32_t N, uint32_t L, size_t S = Configuration::THREAD_STACK_SIZE>
+class WorkStealingPool : public WorkStealingPoolResource<NoAllocator,N,L,S>
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param priority A priority of worker threads.
+     */
+    WorkStealingPool(int32_t priority);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~WorkStealingPool();
+
+};
+
+template <int32_t N, uint32_t L, size_t S>
+WorkStealingPool<N,L,S>::WorkStealingPool(int32_t priority)
+    : WorkStealingPoolResource<NoAllocator,N,L,S>(priority) {
+}
+
+template <int32_t N, uint32_t L, size_t S>
+WorkStealingPool<N,L,S>::~WorkStealingPool()
+{
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_WORKSTEALINGPOOL_HPP_
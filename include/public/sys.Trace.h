@@ -0,0 +1,68 @@
+/**
+ * @file      sys.Trace.h
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ *
+ * @brief FreeRTOS trace macros recording kernel events to the EOOS trace buffer.
+ *
+ * @note The file shall be included at the end of FreeRTOSConfig.h,
+ *       and is C compatible as the kernel sources include it.
+ */
+#ifndef SYS_TRACE_H_
+#define SYS_TRACE_H_
+
+#ifdef EOOS_GLOBAL_SYS_ENABLE_TRACE
+
+#define EOOS_SYS_TRACE_TASK_SWITCHED_IN     (1)
+#define EOOS_SYS_TRACE_TASK_SWITCHED_OUT    (2)
+#define EOOS_SYS_TRACE_TASK_CREATE          (3)
+#define EOOS_SYS_TRACE_TASK_DELETE          (4)
+#define EOOS_SYS_TRACE_TASK_INCREMENT_TICK  (5)
+#define EOOS_SYS_TRACE_QUEUE_SEND           (6)
+#define EOOS_SYS_TRACE_QUEUE_SEND_FAILED    (7)
+#define EOOS_SYS_TRACE_QUEUE_SEND_FROM_ISR  (8)
+#define EOOS_SYS_TRACE_QUEUE_RECEIVE        (9)
+#define EOOS_SYS_TRACE_QUEUE_RECEIVE_FAILED (10)
+#define EOOS_SYS_TRACE_QUEUE_RECEIVE_FROM_ISR (11)
+#define EOOS_SYS_TRACE_QUEUE_BLOCKING_ON_SEND (12)
+#define EOOS_SYS_TRACE_QUEUE_BLOCKING_ON_RECEIVE (13)
+#define EOOS_SYS_TRACE_ISR_TIMER_ENTER      (14)
+#define EOOS_SYS_TRACE_ISR_TIMER_EXIT       (15)
+#define EOOS_SYS_TRACE_ISR_SVCALL_ENTER     (16)
+#define EOOS_SYS_TRACE_ISR_SVCALL_EXIT      (17)
+#define EOOS_SYS_TRACE_SEMAPHORE_RELEASE_FROM_ISR (18)
+#define EOOS_SYS_TRACE_YIELD_ENTER          (19)
+#define EOOS_SYS_TRACE_YIELD_EXIT           (20)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Records a kernel event.
+ *
+ * @param event  An event identifier.
+ * @param object A kernel object of the event.
+ */
+void eoos_sys_trace(unsigned int event, void const* object);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define traceTASK_SWITCHED_IN()                     eoos_sys_trace(EOOS_SYS_TRACE_TASK_SWITCHED_IN, pxCurrentTCB)
+#define traceTASK_SWITCHED_OUT()                    eoos_sys_trace(EOOS_SYS_TRACE_TASK_SWITCHED_OUT, pxCurrentTCB)
+#define traceTASK_CREATE(pxNewTCB)                  eoos_sys_trace(EOOS_SYS_TRACE_TASK_CREATE, (pxNewTCB))
+#define traceTASK_DELETE(pxTaskToDelete)            eoos_sys_trace(EOOS_SYS_TRACE_TASK_DELETE, (pxTaskToDelete))
+#define traceTASK_INCREMENT_TICK(xTickCount)        eoos_sys_trace(EOOS_SYS_TRACE_TASK_INCREMENT_TICK, 0)
+#define traceQUEUE_SEND(pxQueue)                    eoos_sys_trace(EOOS_SYS_TRACE_QUEUE_SEND, (pxQueue))
+#define traceQUEUE_SEND_FAILED(pxQueue)             eoos_sys_trace(EOOS_SYS_TRACE_QUEUE_SEND_FAILED, (pxQueue))
+#define traceQUEUE_SEND_FROM_ISR(pxQueue)           eoos_sys_trace(EOOS_SYS_TRACE_QUEUE_SEND_FROM_ISR, (pxQueue))
+#define traceQUEUE_RECEIVE(pxQueue)                 eoos_sys_trace(EOOS_SYS_TRACE_QUEUE_RECEIVE, (pxQueue))
+#define traceQUEUE_RECEIVE_FAILED(pxQueue)          eoos_sys_trace(EOOS_SYS_TRACE_QUEUE_RECEIVE_FAILED, (pxQueue))
+#define traceQUEUE_RECEIVE_FROM_ISR(pxQueue)        eoos_sys_trace(EOOS_SYS_TRACE_QUEUE_RECEIVE_FROM_ISR, (pxQueue))
+#define traceBLOCKING_ON_QUEUE_SEND(pxQueue)        eoos_sys_trace(EOOS_SYS_TRACE_QUEUE_BLOCKING_ON_SEND, (pxQueue))
+#define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue)     eoos_sys_trace(EOOS_SYS_TRACE_QUEUE_BLOCKING_ON_RECEIVE, (pxQueue))
+
+#endif // EOOS_GLOBAL_SYS_ENABLE_TRACE
+#endif // SYS_TRACE_H_
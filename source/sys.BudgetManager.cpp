@@ -0,0 +1,350 @@
+/**
+ * @file      sys.BudgetManager.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.BudgetManager.hpp"
+#include "sys.Scheduler.hpp"
+#include "sys.PriorityMap.hpp"
+#include "sys.TimeMap.hpp"
+#include "sys.ThreadRegistry.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+BudgetManager::BudgetManager(Scheduler& scheduler)
+    : NonCopyable<NoAllocator>()
+    , api::Runnable()
+    , scheduler_( scheduler )
+    , priorityMin_( PriorityMap::toKernel(api::Thread::PRIORITY_MIN) )
+    , head_( NULLPTR )
+    , handling_( NULLPTR )
+    , isPended_( false )
+    , isActive_( false ) {
+    bool_t const isConstructed( construct(scheduler) );
+    setConstructed( isConstructed );
+}
+
+BudgetManager::~BudgetManager()
+{
+    static_cast<void>( scheduler_.removeTickHook(*this) );
+}
+
+bool_t BudgetManager::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+void BudgetManager::start()
+{
+    if( isConstructed() )
+    {
+        bool_t isToPend( false );
+        ::UBaseType_t const mask( taskENTER_CRITICAL_FROM_ISR() );
+        // The tick hooks are called before the context is switched,
+        // thus the current task is the one the elapsed tick belongs to
+        ::TaskHandle_t const task( ::xTaskGetCurrentTaskHandle() );
+        Budget* budget( head_ );
+        while( budget != NULLPTR )
+        {
+            budget->elapsed_++;
+            if( budget->task_ == task )
+            {
+                budget->used_++;
+                if( (budget->used_ > budget->budget_) && !budget->isExceeded_ )
+                {
+                    budget->isExceeded_ = true;
+                    budget->overruns_++;
+                    budget->isToReport_ = (budget->routine_ != NULLPTR);
+                    budget->isToUpdate_ = (budget->action_ == Budget::ACTION_DEMOTE);
+                }
+            }
+            if( budget->elapsed_ >= budget->period_ )
+            {
+                budget->usage_ = budget->used_;
+                budget->used_ = 0;
+                budget->elapsed_ = 0;
+                if( budget->isExceeded_ )
+                {
+                    budget->isExceeded_ = false;
+                    budget->isToUpdate_ = (budget->action_ == Budget::ACTION_DEMOTE);
+                }
+            }
+            if( (budget->isToReport_ || budget->isToUpdate_) && !isPended_ )
+            {
+                isPended_ = true;
+                isToPend = true;
+            }
+            budget = budget->next_;
+        }
+        taskEXIT_CRITICAL_FROM_ISR(mask);
+        if( isToPend )
+        {
+            ::BaseType_t xHigherPriorityTaskWoken( pdFALSE );
+            ::BaseType_t const isPended( ::xTimerPendFunctionCallFromISR(handle, this, 0, &xHigherPriorityTaskWoken) );
+            if( isPended != pdPASS )
+            {
+                // Try again on next tick
+                isPended_ = false;
+            }
+            else if( xHigherPriorityTaskWoken != pdFALSE )
+            {
+                Scheduler::yieldThreadFromInterrupt();
+            }
+            else
+            {
+            }
+        }
+    }
+}
+
+bool_t BudgetManager::attach(Budget& budget)
+{
+    bool_t res( false );
+    ::TaskHandle_t const task( ::xTaskGetCurrentTaskHandle() );
+    if( isConstructed() && budget.isConstructed() && (budget.manager_ == NULLPTR) && (task != NULL) && activate() )
+    {
+        ::UBaseType_t const priority( getBasePriority(task) );
+        taskENTER_CRITICAL();
+        budget.task_ = task;
+        budget.priority_ = priority;
+        budget.elapsed_ = 0;
+        budget.used_ = 0;
+        budget.isExceeded_ = false;
+        budget.isDemoted_ = false;
+        budget.isToReport_ = false;
+        budget.isToUpdate_ = false;
+        budget.manager_ = this;
+        budget.next_ = head_;
+        head_ = &budget;
+        taskEXIT_CRITICAL();
+        res = true;
+    }
+    return res;
+}
+
+bool_t BudgetManager::detach(Budget& budget)
+{
+    bool_t res( false );
+    if( isConstructed() && (budget.manager_ == this) )
+    {
+        // The daemon does not touch the budget after calling its routine,
+        // thus the routine is allowed to detach the budget
+        bool_t const isDaemon( ::xTaskGetCurrentTaskHandle() == ::xTimerGetTimerDaemonTaskHandle() );
+        bool_t isHandled( true );
+        bool_t isDemoted( false );
+        while( isHandled )
+        {
+            taskENTER_CRITICAL();
+            isHandled = (handling_ == &budget) && !isDaemon;
+            if( !isHandled )
+            {
+                Budget** next( &head_ );
+                while( *next != NULLPTR )
+                {
+                    if( *next == &budget )
+                    {
+                        *next = budget.next_;
+                        break;
+                    }
+                    next = &(*next)->next_;
+                }
+                budget.next_ = NULLPTR;
+                budget.manager_ = NULLPTR;
+                isDemoted = budget.isDemoted_;
+                budget.isDemoted_ = false;
+            }
+            taskEXIT_CRITICAL();
+            if( isHandled )
+            {
+                // The daemon might have a lower priority than the caller
+                ::vTaskDelay(1);
+            }
+        }
+        if( isDemoted )
+        {
+            ::vTaskPrioritySet(budget.task_, budget.priority_);
+        }
+        budget.task_ = NULL;
+        res = true;
+    }
+    return res;
+}
+
+bool_t BudgetManager::construct(Scheduler& scheduler)
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( !scheduler.isConstructed() )
+        {
+            break;
+        }
+        // The fast boot hooks the manager to the system tick on its first use
+        #ifndef EOOS_GLOBAL_SYS_ENABLE_FAST_BOOT
+        if( !activate() )
+        {
+            break;
+        }
+        #endif // EOOS_GLOBAL_SYS_ENABLE_FAST_BOOT
+        res = true;
+    } while(false);
+    return res;
+}
+
+bool_t BudgetManager::activate()
+{
+    taskENTER_CRITICAL();
+    if( !isActive_ )
+    {
+        isActive_ = scheduler_.addTickHook(*this);
+    }
+    bool_t const isActive( isActive_ );
+    taskEXIT_CRITICAL();
+    return isActive;
+}
+
+void BudgetManager::handle()
+{
+    while(true)
+    {
+        Budget* budget( NULLPTR );
+        api::Runnable* routine( NULLPTR );
+        ::TaskHandle_t task( NULL );
+        ::UBaseType_t priority( tskIDLE_PRIORITY );
+        bool_t isToDemote( false );
+        bool_t isToRestore( false );
+        taskENTER_CRITICAL();
+        for(Budget* b( head_ ); b != NULLPTR; b = b->next_)
+        {
+            if( b->isToReport_ || b->isToUpdate_ )
+            {
+                budget = b;
+                break;
+            }
+        }
+        if( budget != NULLPTR )
+        {
+            if( budget->isToReport_ )
+            {
+                routine = budget->routine_;
+            }
+            if( budget->isToUpdate_ )
+            {
+                isToDemote = budget->isExceeded_ && !budget->isDemoted_;
+                isToRestore = !budget->isExceeded_ && budget->isDemoted_;
+                budget->isDemoted_ = budget->isExceeded_;
+            }
+            budget->isToReport_ = false;
+            budget->isToUpdate_ = false;
+            task = budget->task_;
+            priority = budget->priority_;
+        }
+        else
+        {
+            isPended_ = false;
+        }
+        // A budget being detached waits till the daemon finishes with it
+        handling_ = budget;
+        taskEXIT_CRITICAL();
+        if( budget == NULLPTR )
+        {
+            break;
+        }
+        if( isToDemote && (priority > priorityMin_) )
+        {
+            ::vTaskPrioritySet(task, priorityMin_);
+        }
+        if( isToRestore )
+        {
+            ::vTaskPrioritySet(task, priority);
+        }
+        if( routine != NULLPTR )
+        {
+            routine->start();
+        }
+    }
+}
+
+::UBaseType_t BudgetManager::getBasePriority(::TaskHandle_t task)
+{
+    ::UBaseType_t priority( tskIDLE_PRIORITY );
+    if( !ThreadRegistry::getPriority(task, priority) )
+    {
+        #if defined(tskKERNEL_VERSION_MAJOR) && (tskKERNEL_VERSION_MAJOR >= 11) && (configUSE_MUTEXES == 1)
+        priority = ::uxTaskBasePriorityGet(task);
+        #else
+        priority = ::uxTaskPriorityGet(task);
+        #endif
+    }
+    return priority;
+}
+
+void BudgetManager::handle(void* pvParameter1, uint32_t ulParameter2)
+{
+    static_cast<void>(ulParameter2); // Avoid MISRA-C++:2008 Rule 0–1–3 and AUTOSAR C++14 Rule A0-1-4
+    BudgetManager* const manager( reinterpret_cast<BudgetManager*>(pvParameter1) );
+    if( manager != NULLPTR )
+    {
+        manager->handle();
+    }
+}
+
+BudgetManager::Budget::Budget(int32_t budget, int32_t period, Action action, api::Runnable* routine)
+    : NonCopyable<NoAllocator>()
+    , budget_( TimeMap::toTicks(budget) )
+    , period_( TimeMap::toTicks(period) )
+    , elapsed_( 0 )
+    , used_( 0 )
+    , usage_( 0 )
+    , action_( action )
+    , routine_( routine )
+    , task_( NULL )
+    , priority_( 0 )
+    , overruns_( 0 )
+    , isExceeded_( false )
+    , isDemoted_( false )
+    , isToReport_( false )
+    , isToUpdate_( false )
+    , manager_( NULLPTR )
+    , next_( NULLPTR ) {
+    bool_t const isConstructed( (budget_ != 0) && (budget_ < period_) );
+    setConstructed( isConstructed );
+}
+
+BudgetManager::Budget::~Budget()
+{
+    if( manager_ != NULLPTR )
+    {
+        static_cast<void>( manager_->detach(*this) );
+    }
+}
+
+bool_t BudgetManager::Budget::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+bool_t BudgetManager::Budget::isExceeded() const
+{
+    return isExceeded_;
+}
+
+uint32_t BudgetManager::Budget::getOverruns() const
+{
+    return overruns_;
+}
+
+::TickType_t BudgetManager::Budget::getUsage() const
+{
+    return usage_;
+}
+
+} // namespace sys
+} // namespace eoos
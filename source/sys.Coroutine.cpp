@@ -0,0 +1,55 @@
+/**
+ * @file      sys.Coroutine.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.Coroutine.hpp"
+#include "sys.TimeMap.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+Coroutine::Coroutine()
+    : NonCopyable<NoAllocator>()
+    , line_( 0 )
+    , start_( 0 )
+    , ticks_( 0 )
+    , isSleeping_( false )
+    , next_( NULLPTR ) {
+}
+
+Coroutine::~Coroutine()
+{
+}
+
+bool_t Coroutine::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+bool_t Coroutine::isDone() const
+{
+    return line_ == LINE_END;
+}
+
+int32_t Coroutine::getLine() const
+{
+    return line_;
+}
+
+void Coroutine::setLine(int32_t line)
+{
+    line_ = line;
+}
+
+void Coroutine::delay(int32_t ms)
+{
+    start_ = ::xTaskGetTickCount();
+    ticks_ = TimeMap::toTicks(ms);
+    isSleeping_ = true;
+}
+
+} // namespace sys
+} // namespace eoos
@@ -0,0 +1,141 @@
+/**
+ * @file      sys.CoroutineScheduler.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.CoroutineScheduler.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+CoroutineScheduler::CoroutineScheduler(size_t stackSize)
+    : NonCopyable<NoAllocator>()
+    , api::Task()
+    , stackSize_( stackSize )
+    , task_( NULL )
+    , head_( NULLPTR )
+    , xHigherPriorityTaskWoken_( pdFALSE ) {
+}
+
+CoroutineScheduler::~CoroutineScheduler()
+{
+}
+
+bool_t CoroutineScheduler::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+void CoroutineScheduler::start()
+{
+    if( isConstructed() )
+    {
+        task_ = ::xTaskGetCurrentTaskHandle();
+        while( head_ != NULLPTR )
+        {
+            ::TickType_t timeout( portMAX_DELAY );
+            if( !resume(timeout) )
+            {
+                static_cast<void>( ::ulTaskNotifyTake(pdTRUE, timeout) );
+            }
+        }
+        task_ = NULL;
+    }
+}
+
+size_t CoroutineScheduler::getStackSize() const
+{
+    return stackSize_;
+}
+
+bool_t CoroutineScheduler::add(Coroutine& coroutine)
+{
+    bool_t res( false );
+    if( isConstructed() && coroutine.isConstructed() && !coroutine.isDone() )
+    {
+        // Append to the tail not to break resuming of the list by a coroutine
+        Coroutine** link( &head_ );
+        while( *link != NULLPTR )
+        {
+            link = &(*link)->next_;
+        }
+        coroutine.next_ = NULLPTR;
+        *link = &coroutine;
+        res = true;
+    }
+    return res;
+}
+
+void CoroutineScheduler::notify()
+{
+    ::TaskHandle_t const task( task_ );
+    if( task != NULL )
+    {
+        static_cast<void>( ::xTaskNotifyGive(task) );
+    }
+}
+
+void CoroutineScheduler::notifyFromInterrupt()
+{
+    xHigherPriorityTaskWoken_ = pdFALSE;
+    ::TaskHandle_t const task( task_ );
+    if( task != NULL )
+    {
+        ::vTaskNotifyGiveFromISR(task, &xHigherPriorityTaskWoken_);
+    }
+}
+
+bool_t CoroutineScheduler::hasToSwitchContex() const
+{
+    return xHigherPriorityTaskWoken_ != pdFALSE;
+}
+
+bool_t CoroutineScheduler::resume(::TickType_t& timeout)
+{
+    bool_t isReady( false );
+    Coroutine** link( &head_ );
+    while( *link != NULLPTR )
+    {
+        Coroutine* const coroutine( *link );
+        Coroutine::State state( Coroutine::STATE_WAITING );
+        if( coroutine->isSleeping_ )
+        {
+            ::TickType_t const elapsed( ::xTaskGetTickCount() - coroutine->start_ );
+            if( elapsed >= coroutine->ticks_ )
+            {
+                coroutine->isSleeping_ = false;
+                state = coroutine->run();
+            }
+        }
+        else
+        {
+            state = coroutine->run();
+        }
+        if( state == Coroutine::STATE_DONE )
+        {
+            *link = coroutine->next_;
+            coroutine->next_ = NULLPTR;
+            continue;
+        }
+        if( state == Coroutine::STATE_READY )
+        {
+            isReady = true;
+        }
+        if( coroutine->isSleeping_ )
+        {
+            ::TickType_t const elapsed( ::xTaskGetTickCount() - coroutine->start_ );
+            ::TickType_t const remaining( (elapsed < coroutine->ticks_) ? (coroutine->ticks_ - elapsed) : 0 );
+            if( remaining < timeout )
+            {
+                timeout = remaining;
+            }
+        }
+        link = &coroutine->next_;
+    }
+    return isReady || (timeout == 0);
+}
+
+} // namespace sys
+} // namespace eoos
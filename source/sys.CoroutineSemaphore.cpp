@@ -0,0 +1,74 @@
+/**
+ * @file      sys.CoroutineSemaphore.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.CoroutineSemaphore.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+CoroutineSemaphore::CoroutineSemaphore(CoroutineScheduler& scheduler, int32_t permits)
+    : NonCopyable<NoAllocator>()
+    , scheduler_( scheduler )
+    , permits_( permits ) {
+    bool_t const isConstructed( permits >= 0 );
+    setConstructed( isConstructed );
+}
+
+CoroutineSemaphore::~CoroutineSemaphore()
+{
+}
+
+bool_t CoroutineSemaphore::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+bool_t CoroutineSemaphore::acquire()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        taskENTER_CRITICAL();
+        if( permits_ > 0 )
+        {
+            permits_--;
+            res = true;
+        }
+        taskEXIT_CRITICAL();
+    }
+    return res;
+}
+
+void CoroutineSemaphore::release()
+{
+    if( isConstructed() )
+    {
+        taskENTER_CRITICAL();
+        permits_++;
+        taskEXIT_CRITICAL();
+        scheduler_.notify();
+    }
+}
+
+void CoroutineSemaphore::releaseFromInterrupt()
+{
+    if( isConstructed() )
+    {
+        ::UBaseType_t const mask( taskENTER_CRITICAL_FROM_ISR() );
+        permits_++;
+        taskEXIT_CRITICAL_FROM_ISR(mask);
+        scheduler_.notifyFromInterrupt();
+    }
+}
+
+bool_t CoroutineSemaphore::hasToSwitchContex() const
+{
+    return scheduler_.hasToSwitchContex();
+}
+
+} // namespace sys
+} // namespace eoos
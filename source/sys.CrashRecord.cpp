@@ -0,0 +1,86 @@
+/**
+ * @file      sys.CrashRecord.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.CrashRecord.hpp"
+#include "sys.ThreadRegistry.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+#ifdef EOOS_GLOBAL_SYS_NOINIT_SECTION
+CrashRecord::Record CrashRecord::record_ __attribute__(( section(EOOS_GLOBAL_SYS_NOINIT_SECTION) ));
+#else
+CrashRecord::Record CrashRecord::record_;
+#endif // EOOS_GLOBAL_SYS_NOINIT_SECTION
+
+void CrashRecord::write(int32_t error)
+{
+    record_.signature = SIGNATURE;
+    record_.error = error;
+    record_.time = static_cast<uint32_t>( ::xTaskGetTickCountFromISR() );
+    record_.task = static_cast<uint32_t>( reinterpret_cast<size_t>( ::xTaskGetCurrentTaskHandle() ) );
+    // Only the FreeRTOS functions which do not enter the kernel critical section
+    // are called, as exiting the section would enable the interrupts
+    ::TaskHandle_t tasks[Configuration::NUMBER_OF_CRASH_THREADS];
+    int32_t const number( ThreadRegistry::getTasksFromInterrupt(tasks, Configuration::NUMBER_OF_CRASH_THREADS) );
+    for(int32_t i( 0 ); i < number; i++)
+    {
+        Thread& thread( record_.threads[i] );
+        // The top of stack is the first member of a task control block
+        ::StaticTask_t const* const tcb( reinterpret_cast<::StaticTask_t const*>(tasks[i]) );
+        thread.task = static_cast<uint32_t>( reinterpret_cast<size_t>(tasks[i]) );
+        thread.stack = static_cast<uint32_t>( reinterpret_cast<size_t>(tcb->pxDummy1) );
+        thread.watermark = static_cast<uint32_t>( ::uxTaskGetStackHighWaterMark(tasks[i]) );
+        thread.priority = static_cast<uint32_t>( ::uxTaskPriorityGetFromISR(tasks[i]) );
+        char_t const* name( ::pcTaskGetName(tasks[i]) );
+        for(int32_t j( 0 ); j < configMAX_TASK_NAME_LEN; j++)
+        {
+            thread.name[j] = (name != NULLPTR) ? name[j] : '\0';
+            if( thread.name[j] == '\0' )
+            {
+                name = NULLPTR;
+            }
+        }
+        thread.name[configMAX_TASK_NAME_LEN - 1] = '\0';
+    }
+    record_.numberOfThreads = number;
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_TRACE
+    record_.numberOfTraces = TraceRecorder::getLast(record_.traces, Configuration::NUMBER_OF_CRASH_TRACES);
+    #endif // EOOS_GLOBAL_SYS_ENABLE_TRACE
+    record_.checksum = calculate();
+}
+
+CrashRecord::Record const* CrashRecord::get()
+{
+    Record const* record( NULLPTR );
+    if( (record_.signature == SIGNATURE) && (record_.checksum == calculate()) )
+    {
+        record = &record_;
+    }
+    return record;
+}
+
+void CrashRecord::clear()
+{
+    record_.signature = 0;
+    record_.checksum = 0;
+}
+
+uint32_t CrashRecord::calculate()
+{
+    uint32_t checksum( SIGNATURE );
+    uint8_t const* const data( reinterpret_cast<uint8_t const*>(&record_) );
+    size_t const size( reinterpret_cast<uint8_t const*>(&record_.checksum) - data );
+    for(size_t i( 0 ); i < size; i++)
+    {
+        checksum = ((checksum << 5) | (checksum >> 27)) ^ static_cast<uint32_t>(data[i]);
+    }
+    return checksum;
+}
+
+} // namespace sys
+} // namespace eoos
@@ -0,0 +1,117 @@
+/**
+ * @file      sys.EventGroupManager.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.EventGroupManager.hpp"
+#include "lib.UniquePointer.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+api::Heap* EventGroupManager::resource_( NULLPTR );
+
+EventGroupManager::EventGroupManager()
+    : NonCopyable<NoAllocator>()
+    , pool_() {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+EventGroupManager::~EventGroupManager()
+{
+    EventGroupManager::deinitialize();
+}
+
+bool_t EventGroupManager::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+EventGroupManager::Resource* EventGroupManager::create()
+{
+    Resource* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        lib::UniquePointer<Resource> res( new Resource() );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }
+    return ptr;
+}
+
+bool_t EventGroupManager::construct()
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( !pool_.memory.isConstructed() )
+        {
+            break;
+        }
+        if( !EventGroupManager::initialize(&pool_.memory) )
+        {
+            break;
+        }
+        res = true;
+    } while(false);
+    return res;
+}
+
+void* EventGroupManager::allocate(size_t size)
+{
+    if( resource_ != NULLPTR )
+    {
+        return resource_->allocate(size, NULLPTR);
+    }
+    else
+    {
+        return NULLPTR;
+    }
+}
+
+void EventGroupManager::free(void* ptr)
+{
+    if( resource_ != NULLPTR )
+    {
+        resource_->free(ptr);
+    }
+}
+
+bool_t EventGroupManager::initialize(api::Heap* resource)
+{
+    if( resource_ == NULLPTR )
+    {
+        resource_ = resource;
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+void EventGroupManager::deinitialize()
+{
+    resource_ = NULLPTR;
+}
+
+EventGroupManager::ResourcePool::ResourcePool()
+    : mutex_()
+    , memory( mutex_ ) {
+}
+
+} // namespace sys
+} // namespace eoos
@@ -12,6 +12,7 @@ namespace sys
 {
 
 api::Heap* MutexManager::resource_( NULLPTR );
+api::Heap* MutexManager::rwLockResource_( NULLPTR );
 
 MutexManager::MutexManager() 
     : NonCopyable<NoAllocator>()
@@ -49,6 +50,24 @@ api::Mutex* MutexManager::create()
     return ptr;
 }
 
+MutexManager::RwLock* MutexManager::createRwLock()
+{
+    RwLock* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        lib::UniquePointer<RwLock> res( new RwLock() );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }    
+    return ptr;
+}
+
 bool_t MutexManager::construct()
 {
     bool_t res( false );
@@ -62,7 +81,11 @@ bool_t MutexManager::construct()
         {
             break;
         }
-        if( !MutexManager::initialize(&pool_.memory) )
+        if( !pool_.rwLockMemory.isConstructed() )
+        {
+            break;
+        }
+        if( !MutexManager::initialize(&pool_.memory, &pool_.rwLockMemory) )
         {
             break;
         }
@@ -91,11 +114,12 @@ void MutexManager::free(void* ptr)
     }
 }
 
-bool_t MutexManager::initialize(api::Heap* resource)
+bool_t MutexManager::initialize(api::Heap* resource, api::Heap* rwLockResource)
 {
-    if( resource_ == NULLPTR )
+    if( (resource_ == NULLPTR) && (rwLockResource_ == NULLPTR) )
     {
         resource_ = resource;
+        rwLockResource_ = rwLockResource;
         return true;
     }
     else
@@ -107,11 +131,33 @@ bool_t MutexManager::initialize(api::Heap* resource)
 void MutexManager::deinitialize()
 {
     resource_ = NULLPTR;
+    rwLockResource_ = NULLPTR;
 }
 
 MutexManager::ResourcePool::ResourcePool()
     : mutex_()
-    , memory( mutex_ ) {
+    , memory( mutex_ )
+    , rwLockMemory( mutex_ ) {
+}
+
+void* MutexManager::RwLockAllocator::allocate(size_t size)
+{
+    if( rwLockResource_ != NULLPTR )
+    {
+        return rwLockResource_->allocate(size, NULLPTR);
+    }
+    else
+    {
+        return NULLPTR;
+    }
+}
+
+void MutexManager::RwLockAllocator::free(void* ptr)
+{
+    if( rwLockResource_ != NULLPTR )
+    {
+        rwLockResource_->free(ptr);
+    }
 }
 
 } // namespace sys
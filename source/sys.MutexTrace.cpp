@@ -0,0 +1,130 @@
+/**
+ * @file      sys.MutexTrace.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.MutexTrace.hpp"
+
+#ifdef EOOS_GLOBAL_SYS_ENABLE_MUTEX_TRACE
+
+namespace eoos
+{
+namespace sys
+{
+
+MutexTrace::Record MutexTrace::records_[NUMBER_OF_RECORDS];
+
+MutexTrace::Record* MutexTrace::allocate(void const* mutex)
+{
+    Record* record( NULLPTR );
+    taskENTER_CRITICAL();
+    for(int32_t i(0); i<NUMBER_OF_RECORDS; i++)
+    {
+        if( records_[i].mutex == NULLPTR )
+        {
+            record = &records_[i];
+            Record const empty = {mutex, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+            *record = empty;
+            break;
+        }
+    }
+    taskEXIT_CRITICAL();
+    return record;
+}
+
+void MutexTrace::free(Record* record)
+{
+    if( record != NULLPTR )
+    {
+        taskENTER_CRITICAL();
+        record->mutex = NULLPTR;
+        taskEXIT_CRITICAL();
+    }
+}
+
+void MutexTrace::contend(Record* record, ::TaskHandle_t holder)
+{
+    if( record != NULLPTR )
+    {
+        bool_t const isInherited( (holder != NULL) && (::uxTaskPriorityGet(holder) < ::uxTaskPriorityGet(NULL)) );
+        taskENTER_CRITICAL();
+        record->contentions++;
+        record->contenders++;
+        if( record->contenders > record->maxContenders )
+        {
+            record->maxContenders = record->contenders;
+        }
+        if( isInherited )
+        {
+            record->inheritances++;
+        }
+        taskEXIT_CRITICAL();
+    }
+}
+
+void MutexTrace::acquire(Record* record, uint32_t begin, bool_t isContended)
+{
+    if( record != NULLPTR )
+    {
+        uint32_t const time( getTime() - begin );
+        taskENTER_CRITICAL();
+        record->locks++;
+        if( isContended )
+        {
+            record->contenders--;
+            record->waitTotal += time;
+            if( time > record->waitMax )
+            {
+                record->waitMax = time;
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+}
+
+void MutexTrace::release(Record* record, uint32_t begin)
+{
+    if( record != NULLPTR )
+    {
+        uint32_t const time( getTime() - begin );
+        taskENTER_CRITICAL();
+        record->holdTotal += time;
+        if( time > record->holdMax )
+        {
+            record->holdMax = time;
+        }
+        taskEXIT_CRITICAL();
+    }
+}
+
+bool_t MutexTrace::getRecord(int32_t index, Record& record)
+{
+    bool_t res( false );
+    if( (0 <= index) && (index < NUMBER_OF_RECORDS) )
+    {
+        taskENTER_CRITICAL();
+        record = records_[index];
+        taskEXIT_CRITICAL();
+        res = record.mutex != NULLPTR;
+    }
+    return res;
+}
+
+int32_t MutexTrace::getNumberOfRecords()
+{
+    return NUMBER_OF_RECORDS;
+}
+
+uint32_t MutexTrace::getTime()
+{
+    #if defined (configGENERATE_RUN_TIME_STATS) && (configGENERATE_RUN_TIME_STATS == 1)
+    return static_cast<uint32_t>( portGET_RUN_TIME_COUNTER_VALUE() );
+    #else
+    return static_cast<uint32_t>( ::xTaskGetTickCount() );
+    #endif
+}
+
+} // namespace sys
+} // namespace eoos
+
+#endif // EOOS_GLOBAL_SYS_ENABLE_MUTEX_TRACE
@@ -0,0 +1,100 @@
+/**
+ * @file      sys.PriorityMap.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.PriorityMap.hpp"
+
+/**
+ * @brief Maps an EOOS priority level to a FreeRTOS priority linearly.
+ *
+ * @param p An EOOS priority level from PRIORITY_MIN to PRIORITY_MAX.
+ */
+#define EOOS_SYS_PRIORITY_LINEAR(p) \
+    ( 1U + ( ( static_cast<::UBaseType_t>(p) - 1U ) * ( static_cast<::UBaseType_t>(configMAX_PRIORITIES) - 2U ) ) / ( static_cast<::UBaseType_t>(api::Thread::PRIORITY_MAX) - 1U ) )
+
+namespace eoos
+{
+namespace sys
+{
+
+#ifdef EOOS_GLOBAL_SYS_PRIORITY_MAP
+const ::UBaseType_t PriorityMap::MAP[NUMBER_OF_LEVELS] = EOOS_GLOBAL_SYS_PRIORITY_MAP;
+#else
+const ::UBaseType_t PriorityMap::MAP[NUMBER_OF_LEVELS] = {
+    tskIDLE_PRIORITY,
+    EOOS_SYS_PRIORITY_LINEAR(1),
+    EOOS_SYS_PRIORITY_LINEAR(2),
+    EOOS_SYS_PRIORITY_LINEAR(3),
+    EOOS_SYS_PRIORITY_LINEAR(4),
+    EOOS_SYS_PRIORITY_LINEAR(5),
+    EOOS_SYS_PRIORITY_LINEAR(6),
+    EOOS_SYS_PRIORITY_LINEAR(7),
+    EOOS_SYS_PRIORITY_LINEAR(8),
+    EOOS_SYS_PRIORITY_LINEAR(9),
+    EOOS_SYS_PRIORITY_LINEAR(10)
+};
+EOOS_SYS_STATIC_ASSERT(api::Thread::PRIORITY_MIN == 1 && api::Thread::PRIORITY_MAX == 10, "Default priority map expects EOOS levels from 1 to 10");
+#endif // EOOS_GLOBAL_SYS_PRIORITY_MAP
+
+bool_t PriorityMap::isPriority(int32_t priority)
+{
+    bool_t res( false );
+    if( (api::Thread::PRIORITY_MIN <= priority) && (priority <= api::Thread::PRIORITY_MAX) )
+    {
+        res = true;
+    }
+    else if( priority == api::Thread::PRIORITY_IDLE )
+    {
+        res = true;
+    }
+    else
+    {
+        res = false;
+    }
+    return res;
+}
+
+::UBaseType_t PriorityMap::toKernel(int32_t priority)
+{
+    ::UBaseType_t res( tskIDLE_PRIORITY );
+    if( isPriority(priority) )
+    {
+        res = MAP[priority];
+    }
+    return res;
+}
+
+int32_t PriorityMap::toEoos(::UBaseType_t priority)
+{
+    int32_t res( api::Thread::PRIORITY_IDLE );
+    for(int32_t i( api::Thread::PRIORITY_MAX ); i >= api::Thread::PRIORITY_MIN; i--)
+    {
+        if( MAP[i] <= priority )
+        {
+            res = i;
+            break;
+        }
+    }
+    return res;
+}
+
+bool_t PriorityMap::isValid()
+{
+    bool_t res( true );
+    for(int32_t i( 0 ); i < NUMBER_OF_LEVELS; i++)
+    {
+        if( MAP[i] >= static_cast<::UBaseType_t>(configMAX_PRIORITIES) )
+        {
+            res = false;
+        }
+        if( (i > 0) && (MAP[i] < MAP[i - 1]) )
+        {
+            res = false;
+        }
+    }
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
@@ -0,0 +1,396 @@
+/**
+ * @file      sys.RealTimeManager.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.RealTimeManager.hpp"
+#include "sys.Scheduler.hpp"
+#include "sys.PriorityMap.hpp"
+#include "sys.TimeMap.hpp"
+#include "sys.ThreadRegistry.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+RealTimeManager::RealTimeManager(Scheduler& scheduler)
+    : NonCopyable<NoAllocator>()
+    , api::Runnable()
+    , scheduler_( scheduler )
+    , priorityMax_( PriorityMap::toKernel(api::Thread::PRIORITY_MAX) )
+    , priorityMin_( PriorityMap::toKernel(api::Thread::PRIORITY_NORM) )
+    , mutex_()
+    , head_( NULLPTR )
+    , alarm_( NULLPTR )
+    , misses_( 0 )
+    , isPended_( false )
+    , isActive_( false ) {
+    bool_t const isConstructed( construct(scheduler) );
+    setConstructed( isConstructed );
+}
+
+RealTimeManager::~RealTimeManager()
+{
+    static_cast<void>( scheduler_.removeTickHook(*this) );
+}
+
+bool_t RealTimeManager::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+void RealTimeManager::start()
+{
+    if( isConstructed() )
+    {
+        bool_t isToPend( false );
+        ::UBaseType_t const mask( taskENTER_CRITICAL_FROM_ISR() );
+        ::TickType_t const now( ::xTaskGetTickCountFromISR() );
+        Periodic* periodic( head_ );
+        while( periodic != NULLPTR )
+        {
+            if( !periodic->isDone_ && !periodic->isMissed_ && ((now - periodic->release_) >= periodic->deadline_) )
+            {
+                periodic->isMissed_ = true;
+                periodic->misses_++;
+                misses_++;
+                if( (alarm_ != NULLPTR) && !isPended_ )
+                {
+                    isPended_ = true;
+                    isToPend = true;
+                }
+            }
+            periodic = periodic->next_;
+        }
+        taskEXIT_CRITICAL_FROM_ISR(mask);
+        if( isToPend )
+        {
+            ::BaseType_t xHigherPriorityTaskWoken( pdFALSE );
+            ::BaseType_t const isPended( ::xTimerPendFunctionCallFromISR(alarm, this, 0, &xHigherPriorityTaskWoken) );
+            if( isPended != pdPASS )
+            {
+                // The miss is still counted, but the alarm is lost
+                isPended_ = false;
+            }
+            else if( xHigherPriorityTaskWoken != pdFALSE )
+            {
+                Scheduler::yieldThreadFromInterrupt();
+            }
+            else
+            {
+            }
+        }
+    }
+}
+
+bool_t RealTimeManager::admit(Periodic& periodic)
+{
+    bool_t res( false );
+    ::TaskHandle_t const task( ::xTaskGetCurrentTaskHandle() );
+    if( isConstructed() && periodic.isConstructed() && (periodic.manager_ == NULLPTR) && (task != NULL) && activate() )
+    {
+        if( mutex_.lock() )
+        {
+            // The activity is not checked by the tick hook until the first job is released
+            periodic.isDone_ = true;
+            periodic.task_ = task;
+            taskENTER_CRITICAL();
+            link(periodic);
+            taskEXIT_CRITICAL();
+            int32_t number( 0 );
+            for(Periodic* p( head_ ); p != NULLPTR; p = p->next_)
+            {
+                number++;
+            }
+            if( (static_cast<::UBaseType_t>(number) <= (priorityMax_ - priorityMin_)) && analyse(head_) )
+            {
+                periodic.priority_ = ::uxTaskPriorityGet(task);
+                periodic.manager_ = this;
+                assign();
+                taskENTER_CRITICAL();
+                ::TickType_t const now( ::xTaskGetTickCount() );
+                periodic.release_ = now;
+                periodic.wake_ = now;
+                periodic.isMissed_ = false;
+                periodic.isDone_ = false;
+                taskEXIT_CRITICAL();
+                res = true;
+            }
+            else
+            {
+                taskENTER_CRITICAL();
+                unlink(periodic);
+                taskEXIT_CRITICAL();
+                periodic.task_ = NULL;
+                // Restore response times of the admitted activities
+                static_cast<void>( analyse(head_) );
+            }
+            static_cast<void>( mutex_.unlock() );
+        }
+    }
+    return res;
+}
+
+bool_t RealTimeManager::withdraw(Periodic& periodic)
+{
+    bool_t res( false );
+    if( isConstructed() && (periodic.manager_ == this) )
+    {
+        if( mutex_.lock() )
+        {
+            taskENTER_CRITICAL();
+            unlink(periodic);
+            periodic.manager_ = NULLPTR;
+            taskEXIT_CRITICAL();
+            if( !ThreadRegistry::assign(periodic.task_, tskIDLE_PRIORITY) )
+            {
+                ::vTaskPrioritySet(periodic.task_, periodic.priority_);
+            }
+            periodic.task_ = NULL;
+            assign();
+            static_cast<void>( analyse(head_) );
+            static_cast<void>( mutex_.unlock() );
+            res = true;
+        }
+    }
+    return res;
+}
+
+void RealTimeManager::setAlarm(api::Runnable* alarm)
+{
+    if( isConstructed() )
+    {
+        taskENTER_CRITICAL();
+        alarm_ = alarm;
+        taskEXIT_CRITICAL();
+    }
+}
+
+uint32_t RealTimeManager::getMisses() const
+{
+    return misses_;
+}
+
+bool_t RealTimeManager::construct(Scheduler& scheduler)
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( !mutex_.isConstructed() )
+        {
+            break;
+        }
+        if( priorityMax_ <= priorityMin_ )
+        {
+            break;
+        }
+        if( !scheduler.isConstructed() )
+        {
+            break;
+        }
+        // The fast boot hooks the manager to the system tick on its first use
+        #ifndef EOOS_GLOBAL_SYS_ENABLE_FAST_BOOT
+        if( !activate() )
+        {
+            break;
+        }
+        #endif // EOOS_GLOBAL_SYS_ENABLE_FAST_BOOT
+        res = true;
+    } while(false);
+    return res;
+}
+
+bool_t RealTimeManager::activate()
+{
+    taskENTER_CRITICAL();
+    if( !isActive_ )
+    {
+        isActive_ = scheduler_.addTickHook(*this);
+    }
+    bool_t const isActive( isActive_ );
+    taskEXIT_CRITICAL();
+    return isActive;
+}
+
+bool_t RealTimeManager::analyse(Periodic* head)
+{
+    bool_t res( true );
+    for(Periodic* periodic( head ); periodic != NULLPTR; periodic = periodic->next_)
+    {
+        // Iterate R = C + sum(ceil(R / Tj) * Cj) of higher priority activities to a fixed point
+        ::TickType_t response( periodic->wcet_ );
+        while(true)
+        {
+            ::TickType_t next( periodic->wcet_ );
+            for(Periodic* higher( head ); higher != periodic; higher = higher->next_)
+            {
+                next += ( (response + higher->period_ - 1) / higher->period_ ) * higher->wcet_;
+            }
+            if( (next == response) || (next > periodic->deadline_) )
+            {
+                response = next;
+                break;
+            }
+            response = next;
+        }
+        periodic->response_ = response;
+        if( response > periodic->deadline_ )
+        {
+            res = false;
+        }
+    }
+    return res;
+}
+
+void RealTimeManager::link(Periodic& periodic)
+{
+    Periodic** next( &head_ );
+    while( *next != NULLPTR )
+    {
+        Periodic* const p( *next );
+        if( (periodic.deadline_ < p->deadline_) || ((periodic.deadline_ == p->deadline_) && (periodic.period_ < p->period_)) )
+        {
+            break;
+        }
+        next = &p->next_;
+    }
+    periodic.next_ = *next;
+    *next = &periodic;
+}
+
+void RealTimeManager::unlink(Periodic& periodic)
+{
+    Periodic** next( &head_ );
+    while( *next != NULLPTR )
+    {
+        if( *next == &periodic )
+        {
+            *next = periodic.next_;
+            periodic.next_ = NULLPTR;
+            break;
+        }
+        next = &(*next)->next_;
+    }
+}
+
+void RealTimeManager::assign()
+{
+    ::UBaseType_t priority( priorityMax_ );
+    for(Periodic* periodic( head_ ); periodic != NULLPTR; periodic = periodic->next_)
+    {
+        // An EOOS thread keeps the priority as its own, and a FreeRTOS task gets it directly
+        if( !ThreadRegistry::assign(periodic->task_, priority) )
+        {
+            ::vTaskPrioritySet(periodic->task_, priority);
+        }
+        priority--;
+    }
+}
+
+void RealTimeManager::alarm()
+{
+    taskENTER_CRITICAL();
+    api::Runnable* const alarm( alarm_ );
+    isPended_ = false;
+    taskEXIT_CRITICAL();
+    if( alarm != NULLPTR )
+    {
+        alarm->start();
+    }
+}
+
+void RealTimeManager::alarm(void* pvParameter1, uint32_t ulParameter2)
+{
+    static_cast<void>(ulParameter2); // Avoid MISRA-C++:2008 Rule 0–1–3 and AUTOSAR C++14 Rule A0-1-4
+    RealTimeManager* const manager( reinterpret_cast<RealTimeManager*>(pvParameter1) );
+    if( manager != NULLPTR )
+    {
+        manager->alarm();
+    }
+}
+
+RealTimeManager::Periodic::Periodic(int32_t period, int32_t wcet, int32_t deadline)
+    : NonCopyable<NoAllocator>()
+    , period_( TimeMap::toTicks(period) )
+    , wcet_( TimeMap::toTicks(wcet) )
+    , deadline_( TimeMap::toTicks(deadline) )
+    , response_( 0 )
+    , responseMax_( 0 )
+    , release_( 0 )
+    , wake_( 0 )
+    , task_( NULL )
+    , priority_( 0 )
+    , isDone_( true )
+    , isMissed_( false )
+    , misses_( 0 )
+    , manager_( NULLPTR )
+    , next_( NULLPTR ) {
+    bool_t const isConstructed( (period_ != 0) && (wcet_ != 0) && (wcet_ <= deadline_) && (deadline_ <= period_) );
+    setConstructed( isConstructed );
+}
+
+RealTimeManager::Periodic::~Periodic()
+{
+    if( manager_ != NULLPTR )
+    {
+        static_cast<void>( manager_->withdraw(*this) );
+    }
+}
+
+bool_t RealTimeManager::Periodic::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+bool_t RealTimeManager::Periodic::wait()
+{
+    bool_t res( false );
+    if( isConstructed() && (manager_ != NULLPTR) && (task_ == ::xTaskGetCurrentTaskHandle()) )
+    {
+        taskENTER_CRITICAL();
+        ::TickType_t const response( ::xTaskGetTickCount() - release_ );
+        if( response > responseMax_ )
+        {
+            responseMax_ = response;
+        }
+        isDone_ = true;
+        taskEXIT_CRITICAL();
+        // If the job has overrun its period, the next job is released immediately
+        ::vTaskDelayUntil(&wake_, period_);
+        taskENTER_CRITICAL();
+        release_ = wake_;
+        isMissed_ = false;
+        isDone_ = false;
+        taskEXIT_CRITICAL();
+        res = true;
+    }
+    return res;
+}
+
+bool_t RealTimeManager::Periodic::isAdmitted() const
+{
+    return manager_ != NULLPTR;
+}
+
+uint32_t RealTimeManager::Periodic::getMisses() const
+{
+    return misses_;
+}
+
+::TickType_t RealTimeManager::Periodic::getResponseTime() const
+{
+    return response_;
+}
+
+::TickType_t RealTimeManager::Periodic::getResponseTimeMax() const
+{
+    return responseMax_;
+}
+
+} // namespace sys
+} // namespace eoos
@@ -4,6 +4,7 @@
  * @copyright 2017-2023, Sergey Baigudin, Baigudin Software
  */
 #include "sys.Scheduler.hpp"
+#include "sys.TraceRecorder.hpp"
 #include "lib.UniquePointer.hpp"
 
 namespace eoos
@@ -39,11 +40,16 @@ bool_t Scheduler::isConstructed() const
 }
 
 api::Thread* Scheduler::createThread(api::Task& task)
+{
+    return createThread(task, NULLPTR);
+}
+
+api::Thread* Scheduler::createThread(api::Task& task, char_t const* name)
 {
     api::Thread* ptr( NULLPTR );
     if( isConstructed() )
     {
-        lib::UniquePointer<api::Thread> res( new Resource(task) );
+        lib::UniquePointer<api::Thread> res( new Resource(task, name) );
         if( !res.isNull() )
         {
             if( !res->isConstructed() )
@@ -56,6 +62,35 @@ api::Thread* Scheduler::createThread(api::Task& task)
     return ptr;
 }
 
+bool_t Scheduler::executeDetachedThread(api::Task& task, char_t const* name)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        lib::UniquePointer<Resource> thread( new Resource(task, name) );
+        if( !thread.isNull() && thread->isConstructed() )
+        {
+            if( thread->detach() && thread->execute() )
+            {
+                // The thread deletes itself when the task is done
+                static_cast<void>( thread.release() );
+                res = true;
+            }
+        }
+    }
+    return res;
+}
+
+api::Thread* Scheduler::getCurrentThread()
+{
+    api::Thread* thread( NULLPTR );
+    if( isConstructed() )
+    {
+        thread = ThreadRegistry::getThread(NULL);
+    }
+    return thread;
+}
+
 bool_t Scheduler::sleep(int32_t ms)
 {
     bool_t res( false );
@@ -76,6 +111,26 @@ bool_t Scheduler::yield()
     return res;
 }
 
+bool_t Scheduler::addTickHook(api::Runnable& hook)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = isrTim_.addHook(hook);
+    }
+    return res;
+}
+
+bool_t Scheduler::removeTickHook(api::Runnable& hook)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = isrTim_.removeHook(hook);
+    }
+    return res;
+}
+
 bool_t Scheduler::construct()
 {
     bool_t res( false );
@@ -174,7 +229,13 @@ bool_t Scheduler::sleepThread(int32_t const ms)
 
 bool_t Scheduler::yieldThread()
 {
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_TRACE
+    TraceRecorder::record(EOOS_SYS_TRACE_YIELD_ENTER, ::xTaskGetCurrentTaskHandle());
+    #endif // EOOS_GLOBAL_SYS_ENABLE_TRACE
     taskYIELD();
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_TRACE
+    TraceRecorder::record(EOOS_SYS_TRACE_YIELD_EXIT, ::xTaskGetCurrentTaskHandle());
+    #endif // EOOS_GLOBAL_SYS_ENABLE_TRACE
     return true;
 }
     
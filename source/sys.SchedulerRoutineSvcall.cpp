@@ -4,6 +4,7 @@
  * @copyright 2017-2024, Sergey Baigudin, Baigudin Software
  */
 #include "sys.SchedulerRoutineSvcall.hpp"
+#include "sys.TraceRecorder.hpp"
 
 namespace eoos
 {
@@ -28,7 +29,13 @@ bool_t SchedulerRoutineSvcall::isConstructed() const
 
 void SchedulerRoutineSvcall::start()
 {
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_TRACE
+    TraceRecorder::record(EOOS_SYS_TRACE_ISR_SVCALL_ENTER, this);
+    #endif // EOOS_GLOBAL_SYS_ENABLE_TRACE
     ::vTaskSwitchContext();
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_TRACE
+    TraceRecorder::record(EOOS_SYS_TRACE_ISR_SVCALL_EXIT, this);
+    #endif // EOOS_GLOBAL_SYS_ENABLE_TRACE
 }
 
 bool_t SchedulerRoutineSvcall::construct()
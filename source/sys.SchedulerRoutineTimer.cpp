@@ -4,6 +4,7 @@
  * @copyright 2017-2024, Sergey Baigudin, Baigudin Software
  */
 #include "sys.SchedulerRoutineTimer.hpp"
+#include "sys.TraceRecorder.hpp"
 
 namespace eoos
 {
@@ -12,7 +13,8 @@ namespace sys
 
 SchedulerRoutineTimer::SchedulerRoutineTimer()
     : NonCopyable<NoAllocator>()
-    , api::Runnable() {
+    , api::Runnable()
+    , hooks_() {
     bool_t const isConstructed( construct() );
     setConstructed( isConstructed );    
 }
@@ -28,15 +30,62 @@ bool_t SchedulerRoutineTimer::isConstructed() const
 
 void SchedulerRoutineTimer::start()
 {
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_TRACE
+    TraceRecorder::record(EOOS_SYS_TRACE_ISR_TIMER_ENTER, this);
+    #endif // EOOS_GLOBAL_SYS_ENABLE_TRACE
     // Called by the portable layer each time a tick interrupt occurs.
     // Increments the tick then checks to see if the new tick 
     // value will cause any tasks to be unblocked.
     ::BaseType_t xSwitchRequired( ::xTaskIncrementTick() );
+    for(int32_t i(0); i<NUMBER_OF_HOOKS; i++)
+    {
+        if( hooks_[i] != NULLPTR )
+        {
+            hooks_[i]->start();
+        }
+    }
     // Select the next task to execute
     if(xSwitchRequired == pdTRUE)
     {
         ::vTaskSwitchContext();
     }    
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_TRACE
+    TraceRecorder::record(EOOS_SYS_TRACE_ISR_TIMER_EXIT, this);
+    #endif // EOOS_GLOBAL_SYS_ENABLE_TRACE
+}
+
+bool_t SchedulerRoutineTimer::addHook(api::Runnable& hook)
+{
+    bool_t res( false );
+    taskENTER_CRITICAL();
+    for(int32_t i(0); i<NUMBER_OF_HOOKS; i++)
+    {
+        if( hooks_[i] == NULLPTR )
+        {
+            hooks_[i] = &hook;
+            res = true;
+            break;
+        }
+    }
+    taskEXIT_CRITICAL();
+    return res;
+}
+
+bool_t SchedulerRoutineTimer::removeHook(api::Runnable& hook)
+{
+    bool_t res( false );
+    taskENTER_CRITICAL();
+    for(int32_t i(0); i<NUMBER_OF_HOOKS; i++)
+    {
+        if( hooks_[i] == &hook )
+        {
+            hooks_[i] = NULLPTR;
+            res = true;
+            break;
+        }
+    }
+    taskEXIT_CRITICAL();
+    return res;
 }
 
 bool_t SchedulerRoutineTimer::construct()
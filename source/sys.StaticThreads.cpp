@@ -0,0 +1,55 @@
+/**
+ * @file      sys.StaticThreads.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.StaticThreads.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+StaticThreads::Node* StaticThreads::head_( NULLPTR );
+
+void StaticThreads::add(Node& node)
+{
+    node.next = head_;
+    head_ = &node;
+}
+
+void StaticThreads::remove(Node& node)
+{
+    Node** link( &head_ );
+    while( *link != NULLPTR )
+    {
+        if( *link == &node )
+        {
+            *link = node.next;
+            node.next = NULLPTR;
+            break;
+        }
+        link = &(*link)->next;
+    }
+}
+
+bool_t StaticThreads::execute()
+{
+    bool_t res( true );
+    for(Node* node( head_ ); node != NULLPTR; node = node->next)
+    {
+        if( !node->thread->execute() )
+        {
+            res = false;
+        }
+    }
+    return res;
+}
+
+StaticThreads::Node::Node(api::Thread& thread)
+    : thread( &thread )
+    , next( NULLPTR ) {
+}
+
+} // namespace sys
+} // namespace eoos
@@ -5,6 +5,8 @@
  */
 #include "sys.System.hpp"
 #include "sys.ThreadPrimary.hpp"
+#include "sys.Configuration.hpp"
+#include "sys.StaticThreads.hpp"
 #include "pcb.Board.hpp"
 
 namespace eoos
@@ -12,31 +14,49 @@ namespace eoos
 namespace sys
 {
     
+EOOS_SYS_STATIC_ASSERT((Configuration::MEMORY_SIZE == 0) || (sizeof(System) <= Configuration::MEMORY_SIZE), "System resources exceed EOOS_GLOBAL_SYS_MEMORY_SIZE");
+
 /**
  * @brief EOOS system memory.
  * 
  * @note Memory is uint64_t type to be align 8.  
  */
+#ifdef EOOS_GLOBAL_SYS_MEMORY_SECTION
+static uint64_t memory_[(sizeof(System) >> 3) + 1] __attribute__(( section(EOOS_GLOBAL_SYS_MEMORY_SECTION) ));
+#else
 static uint64_t memory_[(sizeof(System) >> 3) + 1]; 
+#endif // EOOS_GLOBAL_SYS_MEMORY_SECTION
 
 System*         System::eoos_( NULLPTR );    
+#ifdef EOOS_SYS_ENABLE_VAR_CHECK
 uint32_t        System::varBss_;
 uint64_t        System::varDataByConstant_( 0xCAE0ABCD );
 uint32_t        System::varDataByFunction_( System::getCheckValue() );
 System::Check   System::varObjectByDefault_;
 System::Check   System::varObjectByValue_( 0x0137EDA0 );
 System::Check   System::varObjectByTwoValues_( 0xABCD0000, 0x00001234 );
+#endif // EOOS_SYS_ENABLE_VAR_CHECK
 
 System::System()
     : NonCopyable<NoAllocator>()
     , api::System()
     , api::Supervisor()
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_TRACE
+    , trace_()
+    #endif // EOOS_GLOBAL_SYS_ENABLE_TRACE
     , cpu_()
     , heap_()
     , scheduler_(cpu_)
     , mutexManager_()
     , semaphoreManager_()    
     , streamManager_()
+    , timerManager_(scheduler_)
+    , eventGroupManager_()
+    , realTimeManager_(scheduler_)
+    , budgetManager_(scheduler_)
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_WATCHDOG
+    , watchdog_()
+    #endif // EOOS_GLOBAL_SYS_ENABLE_WATCHDOG
     , kernel_(cpu_) {
     bool_t const isConstructed( construct() );
     setConstructed( isConstructed );
@@ -106,6 +126,78 @@ api::CpuProcessor& System::getProcessor()
     return cpu_;
 }
 
+TimerManager& System::getTimerManager()
+{
+    if( !isConstructed() )
+    {   ///< UT Justified Branch: HW dependency
+        exit(ERROR_SYSCALL_CALLED);
+    }
+    return timerManager_;
+}
+
+EventGroupManager& System::getEventGroupManager()
+{
+    if( !isConstructed() )
+    {   ///< UT Justified Branch: HW dependency
+        exit(ERROR_SYSCALL_CALLED);
+    }
+    return eventGroupManager_;
+}
+
+RealTimeManager& System::getRealTimeManager()
+{
+    if( !isConstructed() )
+    {   ///< UT Justified Branch: HW dependency
+        exit(ERROR_SYSCALL_CALLED);
+    }
+    return realTimeManager_;
+}
+
+BudgetManager& System::getBudgetManager()
+{
+    if( !isConstructed() )
+    {   ///< UT Justified Branch: HW dependency
+        exit(ERROR_SYSCALL_CALLED);
+    }
+    return budgetManager_;
+}
+
+#ifdef EOOS_GLOBAL_SYS_ENABLE_TRACE
+
+TraceRecorder& System::getTraceRecorder()
+{
+    if( !isConstructed() )
+    {   ///< UT Justified Branch: HW dependency
+        exit(ERROR_SYSCALL_CALLED);
+    }
+    return trace_;
+}
+
+#endif // EOOS_GLOBAL_SYS_ENABLE_TRACE
+
+#ifdef EOOS_GLOBAL_SYS_ENABLE_WATCHDOG
+
+Watchdog& System::getWatchdog()
+{
+    if( !isConstructed() )
+    {   ///< UT Justified Branch: HW dependency
+        exit(ERROR_SYSCALL_CALLED);
+    }
+    return watchdog_;
+}
+
+#endif // EOOS_GLOBAL_SYS_ENABLE_WATCHDOG
+
+CrashRecord::Record const* System::getCrashRecord() const
+{
+    return CrashRecord::get();
+}
+
+void System::clearCrashRecord()
+{
+    CrashRecord::clear();
+}
+
 int32_t System::run()
 {
     char_t* argv[] = {NULLPTR};
@@ -142,14 +234,22 @@ bool_t System::construct()
         {   ///< UT Justified Branch: HW dependency
             break;
         }
+        #ifdef EOOS_SYS_ENABLE_VAR_CHECK
         if( !isVarChecked() )
         {
             break;
         }
+        #endif // EOOS_SYS_ENABLE_VAR_CHECK
         if( eoos_ != NULLPTR )
         {   ///< UT Justified Branch: Startup dependency
             break;
         }
+        #ifdef EOOS_GLOBAL_SYS_ENABLE_TRACE
+        if( !trace_.isConstructed() )
+        {
+            break;
+        }
+        #endif // EOOS_GLOBAL_SYS_ENABLE_TRACE
         if( !cpu_.isConstructed() )
         {
             break;
@@ -174,6 +274,28 @@ bool_t System::construct()
         {   ///< UT Justified Branch: HW dependency
             break;
         }        
+        if( !timerManager_.isConstructed() )
+        {   ///< UT Justified Branch: HW dependency
+            break;
+        }
+        if( !eventGroupManager_.isConstructed() )
+        {   ///< UT Justified Branch: HW dependency
+            break;
+        }
+        if( !realTimeManager_.isConstructed() )
+        {   ///< UT Justified Branch: HW dependency
+            break;
+        }
+        if( !budgetManager_.isConstructed() )
+        {   ///< UT Justified Branch: HW dependency
+            break;
+        }
+        #ifdef EOOS_GLOBAL_SYS_ENABLE_WATCHDOG
+        if( !watchdog_.isConstructed() )
+        {
+            break;
+        }
+        #endif // EOOS_GLOBAL_SYS_ENABLE_WATCHDOG
         if( !kernel_.isConstructed() )
         {   ///< UT Justified Branch: HW dependency
             break;
@@ -193,7 +315,7 @@ int32_t System::execute(int32_t argc, char_t* argv[])
         if( board.isConstructed() )
         {
             ThreadPrimary thread(scheduler_, argc, argv);
-            if( thread.execute() )
+            if( thread.execute() && StaticThreads::execute() )
             {
                 kernel_.execute();
                 // No extit here, thus no thread join needed for FreeRTOS
@@ -207,9 +329,12 @@ int32_t System::execute(int32_t argc, char_t* argv[])
 void System::exit(Error error)
 {
     portDISABLE_INTERRUPTS();
+    CrashRecord::write(error);
     while( true ){}
 }
 
+#ifdef EOOS_SYS_ENABLE_VAR_CHECK
+
 uint32_t System::getCheckValue()
 {
     return 0x19822014;
@@ -245,6 +370,8 @@ bool_t System::isVarChecked()
     return res;
 }
 
+#endif // EOOS_SYS_ENABLE_VAR_CHECK
+
 void* System::operator new(size_t size)
 {
     void* memory( NULLPTR );
@@ -259,6 +386,8 @@ void System::operator delete(void* const ptr)
 {
 }
 
+#ifdef EOOS_SYS_ENABLE_VAR_CHECK
+
 System::Check::Check()
     : value(0x18172023) {
 }
@@ -271,5 +400,7 @@ System::Check::Check(uint32_t initialHi, uint32_t initialLow)
     : value(initialHi | initialLow) {
 }
 
+#endif // EOOS_SYS_ENABLE_VAR_CHECK
+
 } // namespace sys
 } // namespace eoos
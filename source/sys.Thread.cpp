@@ -15,10 +15,19 @@ Thread::Thread(api::Task& task)
     : ThreadResource<NoAllocator>(task) {
 }
 
+Thread::Thread(api::Task& task, char_t const* name)
+    : ThreadResource<NoAllocator>(task, name) {
+}
+
 Thread::~Thread()
 {
 }
 
+api::Thread* Thread::getCurrent()
+{
+    return ThreadRegistry::getThread(NULL);
+}
+
 bool_t Thread::sleep(int32_t const ms)
 {
     return Scheduler::sleepThread(ms);
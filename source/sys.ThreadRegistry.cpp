@@ -0,0 +1,237 @@
+/**
+ * @file      sys.ThreadRegistry.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.ThreadRegistry.hpp"
+#include "sys.PriorityMap.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+ThreadRegistry::Node* ThreadRegistry::head_( NULLPTR );
+int32_t ThreadRegistry::number_( 0 );
+uint32_t ThreadRegistry::locals_( static_cast<uint32_t>(1) << TLS_INDEX );
+
+void ThreadRegistry::add(Node& node, ::TaskHandle_t task)
+{
+    node.task = task;
+    for(::BaseType_t i( 0 ); i < configNUM_THREAD_LOCAL_STORAGE_POINTERS; i++)
+    {
+        ::vTaskSetThreadLocalStoragePointer(task, i, NULL);
+    }
+    ::vTaskSetThreadLocalStoragePointer(task, TLS_INDEX, &node);
+    taskENTER_CRITICAL();
+    node.prev = NULLPTR;
+    node.next = head_;
+    if( head_ != NULLPTR )
+    {
+        head_->prev = &node;
+    }
+    head_ = &node;
+    number_++;
+    taskEXIT_CRITICAL();
+}
+
+void ThreadRegistry::remove(Node& node)
+{
+    taskENTER_CRITICAL();
+    if( (node.prev != NULLPTR) || (head_ == &node) )
+    {
+        if( node.prev != NULLPTR )
+        {
+            node.prev->next = node.next;
+        }
+        else
+        {
+            head_ = node.next;
+        }
+        if( node.next != NULLPTR )
+        {
+            node.next->prev = node.prev;
+        }
+        node.prev = NULLPTR;
+        node.next = NULLPTR;
+        number_--;
+    }
+    taskEXIT_CRITICAL();
+}
+
+bool_t ThreadRegistry::assign(::TaskHandle_t task, ::UBaseType_t priority)
+{
+    bool_t res( false );
+    // The scheduler is suspended to serialize the assignment with setting the thread priority
+    ::vTaskSuspendAll();
+    Node* const node( getNode(task) );
+    if( node != NULLPTR )
+    {
+        node->assigned = priority;
+        ::UBaseType_t kernel( priority );
+        if( priority == tskIDLE_PRIORITY )
+        {
+            kernel = PriorityMap::toKernel( node->thread->getPriority() );
+        }
+        ::vTaskPrioritySet(task, kernel);
+        res = true;
+    }
+    static_cast<void>( ::xTaskResumeAll() );
+    return res;
+}
+
+bool_t ThreadRegistry::getPriority(::TaskHandle_t task, ::UBaseType_t& priority)
+{
+    bool_t res( false );
+    ::vTaskSuspendAll();
+    Node* const node( getNode(task) );
+    if( node != NULLPTR )
+    {
+        priority = node->assigned;
+        if( priority == tskIDLE_PRIORITY )
+        {
+            priority = PriorityMap::toKernel( node->thread->getPriority() );
+        }
+        res = true;
+    }
+    static_cast<void>( ::xTaskResumeAll() );
+    return res;
+}
+
+api::Thread* ThreadRegistry::getThread(::TaskHandle_t task)
+{
+    Node* const node( getNode(task) );
+    return (node != NULLPTR) ? node->thread : NULLPTR;
+}
+
+char_t const* ThreadRegistry::getName(::TaskHandle_t task)
+{
+    Node* const node( getNode(task) );
+    return (node != NULLPTR) ? node->name : NULLPTR;
+}
+
+int32_t ThreadRegistry::getNumberOfThreads()
+{
+    return number_;
+}
+
+int32_t ThreadRegistry::getThreads(api::Thread* threads[], int32_t size)
+{
+    int32_t number( 0 );
+    if( threads != NULLPTR )
+    {
+        taskENTER_CRITICAL();
+        for(Node* node( head_ ); (node != NULLPTR) && (number < size); node = node->next)
+        {
+            threads[number] = node->thread;
+            number++;
+        }
+        taskEXIT_CRITICAL();
+    }
+    return number;
+}
+
+int32_t ThreadRegistry::getTasks(::TaskHandle_t tasks[], int32_t size)
+{
+    int32_t number( 0 );
+    if( tasks != NULLPTR )
+    {
+        taskENTER_CRITICAL();
+        for(Node* node( head_ ); (node != NULLPTR) && (number < size); node = node->next)
+        {
+            tasks[number] = node->task;
+            number++;
+        }
+        taskEXIT_CRITICAL();
+    }
+    return number;
+}
+
+int32_t ThreadRegistry::getTasksFromInterrupt(::TaskHandle_t tasks[], int32_t size)
+{
+    int32_t number( 0 );
+    if( tasks != NULLPTR )
+    {
+        ::UBaseType_t const mask( taskENTER_CRITICAL_FROM_ISR() );
+        for(Node* node( head_ ); (node != NULLPTR) && (number < size); node = node->next)
+        {
+            tasks[number] = node->task;
+            number++;
+        }
+        taskEXIT_CRITICAL_FROM_ISR(mask);
+    }
+    return number;
+}
+
+::BaseType_t ThreadRegistry::allocateLocal()
+{
+    ::BaseType_t index( TLS_INDEX );
+    taskENTER_CRITICAL();
+    for(::BaseType_t i( 0 ); i < configNUM_THREAD_LOCAL_STORAGE_POINTERS; i++)
+    {
+        uint32_t const bit( static_cast<uint32_t>(1) << i );
+        if( (locals_ & bit) == 0U )
+        {
+            locals_ |= bit;
+            index = i;
+            break;
+        }
+    }
+    taskEXIT_CRITICAL();
+    return index;
+}
+
+void ThreadRegistry::freeLocal(::BaseType_t index)
+{
+    if( (index != TLS_INDEX) && (index < configNUM_THREAD_LOCAL_STORAGE_POINTERS) )
+    {
+        taskENTER_CRITICAL();
+        for(Node* node( head_ ); node != NULLPTR; node = node->next)
+        {
+            ::vTaskSetThreadLocalStoragePointer(node->task, index, NULL);
+        }
+        locals_ &= ~(static_cast<uint32_t>(1) << index);
+        taskEXIT_CRITICAL();
+    }
+}
+
+ThreadRegistry::Node* ThreadRegistry::getNode(::TaskHandle_t task)
+{
+    Node* node( NULLPTR );
+    // The calling task is not defined until the scheduler is started
+    if( (task != NULL) || (::xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED) )
+    {
+        node = reinterpret_cast<Node*>( ::pvTaskGetThreadLocalStoragePointer(task, TLS_INDEX) );
+    }
+    // The slot of a task which is not an EOOS thread might be used by other software
+    if( (node != NULLPTR) && (node->signature != SIGNATURE) )
+    {
+        node = NULLPTR;
+    }
+    return node;
+}
+
+ThreadRegistry::Node::Node(api::Thread& thread, char_t const* string)
+    : signature( SIGNATURE )
+    , thread( &thread )
+    , name()
+    , task( NULL )
+    , assigned( tskIDLE_PRIORITY )
+    , prev( NULLPTR )
+    , next( NULLPTR ) {
+    if( string != NULLPTR )
+    {
+        for(int32_t i( 0 ); i < (configMAX_TASK_NAME_LEN - 1); i++)
+        {
+            name[i] = string[i];
+            if( name[i] == '\0' )
+            {
+                break;
+            }
+        }
+    }
+    name[configMAX_TASK_NAME_LEN - 1] = '\0';
+}
+
+} // namespace sys
+} // namespace eoos
@@ -0,0 +1,48 @@
+/**
+ * @file      sys.ThreadWorker.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.ThreadWorker.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+ThreadLocalResource<ThreadWorker,NoAllocator> ThreadWorker::local_;
+
+ThreadWorker::ThreadWorker()
+    : owner_( NULLPTR )
+    , index_( -1 ) {
+}
+
+void ThreadWorker::set(void const* owner, int32_t index)
+{
+    owner_ = owner;
+    index_ = index;
+}
+
+bool_t ThreadWorker::bind()
+{
+    return local_.set(this);
+}
+
+int32_t ThreadWorker::getIndex(void const* owner)
+{
+    int32_t index( -1 );
+    ThreadWorker const* const worker( local_.get() );
+    if( (worker != NULLPTR) && (worker->owner_ == owner) )
+    {
+        index = worker->index_;
+    }
+    return index;
+}
+
+bool_t ThreadWorker::isAvailable()
+{
+    return local_.isConstructed();
+}
+
+} // namespace sys
+} // namespace eoos
@@ -0,0 +1,28 @@
+/**
+ * @file      sys.TimeMap.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.TimeMap.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+::TickType_t TimeMap::toTicks(int32_t ms)
+{
+    ::TickType_t ticks( 0 );
+    if( ms > 0 )
+    {
+        ticks = pdMS_TO_TICKS( static_cast<::TickType_t>(ms) );
+        if( ticks == 0 )
+        {
+            ticks = 1;
+        }
+    }
+    return ticks;
+}
+
+} // namespace sys
+} // namespace eoos
@@ -0,0 +1,157 @@
+/**
+ * @file      sys.TimerManager.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.TimerManager.hpp"
+#include "sys.PriorityMap.hpp"
+#include "lib.UniquePointer.hpp"
+#include "api.Thread.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+api::Heap* TimerManager::resource_( NULLPTR );
+
+TimerManager::TimerManager(Scheduler& scheduler)
+    : NonCopyable<NoAllocator>()
+    , pool_()
+    , wheel_(scheduler) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+TimerManager::~TimerManager()
+{
+    TimerManager::deinitialize();
+}
+
+bool_t TimerManager::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+TimerManager::Resource* TimerManager::create(api::Runnable& routine, int32_t period, Resource::Type type)
+{
+    Resource* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        lib::UniquePointer<Resource> res( new Resource(routine, period, type) );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }
+    return ptr;
+}
+
+bool_t TimerManager::setDaemonPriority(int32_t priority)
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( !PriorityMap::isPriority(priority) || (priority == api::Thread::PRIORITY_IDLE) )
+        {
+            break;
+        }
+        if( ::xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED )
+        {
+            break;
+        }
+        ::TaskHandle_t const daemon( ::xTimerGetTimerDaemonTaskHandle() );
+        if( daemon == NULL )
+        {
+            break;
+        }
+        ::vTaskPrioritySet( daemon, PriorityMap::toKernel(priority) );
+        res = true;
+    } while(false);
+    return res;
+}
+
+TimerWheel& TimerManager::getWheel()
+{
+    return wheel_;
+}
+
+bool_t TimerManager::construct()
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( !pool_.memory.isConstructed() )
+        {
+            break;
+        }
+        if( !wheel_.isConstructed() )
+        {
+            break;
+        }
+        if( !TimerManager::initialize(&pool_.memory) )
+        {
+            break;
+        }
+        res = true;
+    } while(false);
+    return res;
+}
+
+void* TimerManager::allocate(size_t size)
+{
+    if( resource_ != NULLPTR )
+    {
+        return resource_->allocate(size, NULLPTR);
+    }
+    else
+    {
+        return NULLPTR;
+    }
+}
+
+void TimerManager::free(void* ptr)
+{
+    if( resource_ != NULLPTR )
+    {
+        resource_->free(ptr);
+    }
+}
+
+bool_t TimerManager::initialize(api::Heap* resource)
+{
+    if( resource_ == NULLPTR )
+    {
+        resource_ = resource;
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+void TimerManager::deinitialize()
+{
+    resource_ = NULLPTR;
+}
+
+TimerManager::ResourcePool::ResourcePool()
+    : mutex_()
+    , memory( mutex_ ) {
+}
+
+} // namespace sys
+} // namespace eoos
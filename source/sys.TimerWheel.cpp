@@ -0,0 +1,288 @@
+/**
+ * @file      sys.TimerWheel.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.TimerWheel.hpp"
+#include "sys.Scheduler.hpp"
+#include "sys.TimeMap.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+TimerWheel::TimerWheel(Scheduler& scheduler)
+    : NonCopyable<NoAllocator>()
+    , api::Runnable()
+    , scheduler_( scheduler )
+    , now_( 0 )
+    , processed_( 0 )
+    , isPended_( false )
+    , scan_()
+    , slots_() {
+    bool_t const isConstructed( construct(scheduler) );
+    setConstructed( isConstructed );
+}
+
+TimerWheel::~TimerWheel()
+{
+    static_cast<void>( scheduler_.removeTickHook(*this) );
+}
+
+bool_t TimerWheel::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+void TimerWheel::start()
+{
+    if( isConstructed() )
+    {
+        bool_t isToPend( false );
+        ::UBaseType_t const mask( taskENTER_CRITICAL_FROM_ISR() );
+        now_++;
+        if( !isPended_ )
+        {
+            Link const& slot( slots_[now_ & SLOT_MASK] );
+            // The daemon is idle and all passed slots are processed, thus an empty slot is processed at once
+            if( ((processed_ + 1U) == now_) && (slot.next == &slot) )
+            {
+                processed_ = now_;
+            }
+            else
+            {
+                isPended_ = true;
+                isToPend = true;
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR(mask);
+        if( isToPend )
+        {
+            ::BaseType_t xHigherPriorityTaskWoken( pdFALSE );
+            ::BaseType_t const isPended( ::xTimerPendFunctionCallFromISR(dispatch, this, 0, &xHigherPriorityTaskWoken) );
+            if( isPended != pdPASS )
+            {   
+                // Try again on next tick
+                isPended_ = false;
+            }
+            else if( xHigherPriorityTaskWoken != pdFALSE )
+            {
+                Scheduler::yieldThreadFromInterrupt();
+            }
+            else
+            {
+            }
+        }
+    }
+}
+
+bool_t TimerWheel::schedule(Timeout& timeout, int32_t ms)
+{
+    bool_t res( false );
+    ::TickType_t const ticks( TimeMap::toTicks(ms) );
+    if( isConstructed() && (ticks != 0) )
+    {
+        taskENTER_CRITICAL();
+        insert(timeout, ticks);
+        taskEXIT_CRITICAL();
+        res = true;
+    }
+    return res;
+}
+
+bool_t TimerWheel::scheduleFromInterrupt(Timeout& timeout, int32_t ms)
+{
+    bool_t res( false );
+    ::TickType_t const ticks( TimeMap::toTicks(ms) );
+    if( isConstructed() && (ticks != 0) )
+    {
+        ::UBaseType_t const mask( taskENTER_CRITICAL_FROM_ISR() );
+        insert(timeout, ticks);
+        taskEXIT_CRITICAL_FROM_ISR(mask);
+        res = true;
+    }
+    return res;
+}
+
+bool_t TimerWheel::cancel(Timeout& timeout)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        taskENTER_CRITICAL();
+        if( timeout.wheel_ == this )
+        {
+            unlink(timeout);
+            timeout.wheel_ = NULLPTR;
+            res = true;
+        }
+        taskEXIT_CRITICAL();
+    }
+    return res;
+}
+
+bool_t TimerWheel::construct(Scheduler& scheduler)
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( (NUMBER_OF_SLOTS == 0) || ((NUMBER_OF_SLOTS & SLOT_MASK) != 0) )
+        {
+            break;
+        }
+        if( !scheduler.isConstructed() )
+        {
+            break;
+        }
+        if( !scheduler.addTickHook(*this) )
+        {
+            break;
+        }
+        res = true;
+    } while(false);
+    return res;
+}
+
+void TimerWheel::insert(Timeout& timeout, ::TickType_t ticks)
+{
+    if( timeout.wheel_ != NULLPTR )
+    {
+        unlink(timeout);
+    }
+    timeout.due_ = now_ + static_cast<uint32_t>(ticks);
+    timeout.wheel_ = this;
+    link(slots_[timeout.due_ & SLOT_MASK], timeout);
+}
+
+void TimerWheel::dispatch()
+{
+    while(true)
+    {
+        uint32_t time( 0 );
+        taskENTER_CRITICAL();
+        bool_t const isDone( processed_ == now_ );
+        if( isDone )
+        {
+            isPended_ = false;
+        }
+        else
+        {
+            processed_++;
+            time = processed_;
+            splice(scan_, slots_[time & SLOT_MASK]);
+        }
+        taskEXIT_CRITICAL();
+        if( isDone )
+        {
+            break;
+        }
+        expire(time);
+    }
+}
+
+void TimerWheel::expire(uint32_t time)
+{
+    while(true)
+    {
+        api::Runnable* routine( NULLPTR );
+        taskENTER_CRITICAL();
+        Link* const link( scan_.next );
+        bool_t const isEmpty( link == &scan_ );
+        if( !isEmpty )
+        {
+            Timeout* const timeout( static_cast<Timeout*>(link) );
+            unlink(*timeout);
+            if( timeout->due_ == time )
+            {
+                timeout->wheel_ = NULLPTR;
+                routine = timeout->routine_;
+            }
+            else
+            {
+                // The timeout expires on one of the next wheel turns
+                TimerWheel::link(slots_[time & SLOT_MASK], *timeout);
+            }
+        }
+        taskEXIT_CRITICAL();
+        if( isEmpty )
+        {
+            break;
+        }
+        if( routine != NULLPTR )
+        {
+            routine->start();
+        }
+    }
+}
+
+void TimerWheel::dispatch(void* pvParameter1, uint32_t ulParameter2)
+{
+    static_cast<void>(ulParameter2); // Avoid MISRA-C++:2008 Rule 0–1–3 and AUTOSAR C++14 Rule A0-1-4
+    TimerWheel* const wheel( reinterpret_cast<TimerWheel*>(pvParameter1) );
+    if( wheel != NULLPTR )
+    {
+        wheel->dispatch();
+    }
+}
+
+void TimerWheel::link(Link& head, Link& link)
+{
+    link.next = &head;
+    link.prev = head.prev;
+    head.prev->next = &link;
+    head.prev = &link;
+}
+
+void TimerWheel::unlink(Link& link)
+{
+    link.prev->next = link.next;
+    link.next->prev = link.prev;
+    link.next = &link;
+    link.prev = &link;
+}
+
+void TimerWheel::splice(Link& head, Link& list)
+{
+    if( list.next != &list )
+    {
+        list.next->prev = head.prev;
+        list.prev->next = &head;
+        head.prev->next = list.next;
+        head.prev = list.prev;
+        list.next = &list;
+        list.prev = &list;
+    }
+}
+
+TimerWheel::Link::Link()
+    : next( this )
+    , prev( this ) {
+}
+
+TimerWheel::Timeout::Timeout(api::Runnable& routine)
+    : Link()
+    , routine_( &routine )
+    , wheel_( NULLPTR )
+    , due_( 0 ) {
+}
+
+TimerWheel::Timeout::~Timeout()
+{
+    if( wheel_ != NULLPTR )
+    {
+        static_cast<void>( wheel_->cancel(*this) );
+    }
+}
+
+bool_t TimerWheel::Timeout::isPending() const
+{
+    return wheel_ != NULLPTR;
+}
+
+} // namespace sys
+} // namespace eoos
@@ -0,0 +1,146 @@
+/**
+ * @file      sys.TraceRecorder.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.TraceRecorder.hpp"
+
+#ifdef EOOS_GLOBAL_SYS_ENABLE_TRACE
+
+namespace eoos
+{
+namespace sys
+{
+
+EOOS_SYS_STATIC_ASSERT(configGENERATE_RUN_TIME_STATS == 1, "EOOS_GLOBAL_SYS_ENABLE_TRACE requires configGENERATE_RUN_TIME_STATS for the record time");
+
+TraceRecorder* TraceRecorder::recorder_( NULLPTR );
+
+TraceRecorder::TraceRecorder()
+    : NonCopyable<NoAllocator>()
+    , head_( 0 )
+    , tail_( 0 )
+    , lost_( 0 )
+    , buffer_() {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+TraceRecorder::~TraceRecorder()
+{
+    if( recorder_ == this )
+    {
+        recorder_ = NULLPTR;
+    }
+}
+
+bool_t TraceRecorder::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+bool_t TraceRecorder::read(Record& record)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        ::UBaseType_t const mask( portSET_INTERRUPT_MASK_FROM_ISR() );
+        if( tail_ != head_ )
+        {
+            record = buffer_[tail_ % NUMBER_OF_RECORDS];
+            tail_++;
+            res = true;
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+    }
+    return res;
+}
+
+uint32_t TraceRecorder::getLost() const
+{
+    return lost_;
+}
+
+uint32_t TraceRecorder::getLast(Record records[], uint32_t size)
+{
+    uint32_t number( 0 );
+    TraceRecorder* const recorder( recorder_ );
+    if( (recorder != NULLPTR) && (records != NULLPTR) )
+    {
+        ::UBaseType_t const mask( portSET_INTERRUPT_MASK_FROM_ISR() );
+        uint32_t const head( recorder->head_ );
+        number = (head < NUMBER_OF_RECORDS) ? head : NUMBER_OF_RECORDS;
+        if( number > size )
+        {
+            number = size;
+        }
+        for(uint32_t i( 0 ); i < number; i++)
+        {
+            records[i] = recorder->buffer_[(head - number + i) % NUMBER_OF_RECORDS];
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+    }
+    return number;
+}
+
+void TraceRecorder::record(uint32_t event, void const* object)
+{
+    if( recorder_ != NULLPTR )
+    {
+        recorder_->write(event, object);
+    }
+}
+
+bool_t TraceRecorder::construct()
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( NUMBER_OF_RECORDS == 0 )
+        {
+            break;
+        }
+        if( recorder_ != NULLPTR )
+        {
+            break;
+        }
+        recorder_ = this;
+        res = true;
+    } while(false);
+    return res;
+}
+
+void TraceRecorder::write(uint32_t event, void const* object)
+{
+    ::UBaseType_t const mask( portSET_INTERRUPT_MASK_FROM_ISR() );
+    Record& record( buffer_[head_ % NUMBER_OF_RECORDS] );
+    record.time = getTime();
+    record.object = static_cast<uint32_t>( reinterpret_cast<size_t>(object) );
+    record.event = event;
+    head_++;
+    if( (head_ - tail_) > NUMBER_OF_RECORDS )
+    {
+        tail_++;
+        lost_++;
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+}
+
+uint32_t TraceRecorder::getTime()
+{
+    return static_cast<uint32_t>( portGET_RUN_TIME_COUNTER_VALUE() );
+}
+
+} // namespace sys
+} // namespace eoos
+
+extern "C" void eoos_sys_trace(unsigned int event, void const* object)
+{
+    ::eoos::sys::TraceRecorder::record(static_cast<::eoos::uint32_t>(event), object);
+}
+
+#endif // EOOS_GLOBAL_SYS_ENABLE_TRACE
@@ -0,0 +1,247 @@
+/**
+ * @file      sys.Watchdog.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2024, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.Watchdog.hpp"
+#include "sys.ThreadRegistry.hpp"
+#include "sys.System.hpp"
+#include "sys.TimeMap.hpp"
+
+#ifdef EOOS_GLOBAL_SYS_ENABLE_WATCHDOG
+
+namespace eoos
+{
+namespace sys
+{
+
+Watchdog::Watchdog()
+    : NonCopyable<NoAllocator>()
+    , api::Task()
+    , period_( TimeMap::toTicks(Configuration::WATCHDOG_PERIOD) )
+    , head_( NULLPTR )
+    , hook_( NULLPTR )
+    , diagnostics_()
+    , thread_( *this, "EOOS Watchdog" )
+    , isActive_( false ) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+Watchdog::~Watchdog()
+{
+}
+
+bool_t Watchdog::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+size_t Watchdog::getStackSize() const
+{
+    return Configuration::THREAD_STACK_SIZE;
+}
+
+bool_t Watchdog::add(Heartbeat& heartbeat)
+{
+    bool_t res( false );
+    ::TaskHandle_t const task( ::xTaskGetCurrentTaskHandle() );
+    if( isConstructed() && heartbeat.isConstructed() && (heartbeat.watchdog_ == NULLPTR) && (task != NULL) && activate() )
+    {
+        taskENTER_CRITICAL();
+        heartbeat.task_ = task;
+        heartbeat.last_ = ::xTaskGetTickCount();
+        heartbeat.watchdog_ = this;
+        heartbeat.next_ = head_;
+        head_ = &heartbeat;
+        taskEXIT_CRITICAL();
+        res = true;
+    }
+    return res;
+}
+
+bool_t Watchdog::remove(Heartbeat& heartbeat)
+{
+    bool_t res( false );
+    if( isConstructed() && (heartbeat.watchdog_ == this) )
+    {
+        taskENTER_CRITICAL();
+        Heartbeat** next( &head_ );
+        while( *next != NULLPTR )
+        {
+            if( *next == &heartbeat )
+            {
+                *next = heartbeat.next_;
+                break;
+            }
+            next = &(*next)->next_;
+        }
+        heartbeat.next_ = NULLPTR;
+        heartbeat.watchdog_ = NULLPTR;
+        heartbeat.task_ = NULL;
+        taskEXIT_CRITICAL();
+        res = true;
+    }
+    return res;
+}
+
+void Watchdog::setHook(api::Runnable* hook)
+{
+    if( isConstructed() )
+    {
+        taskENTER_CRITICAL();
+        hook_ = hook;
+        taskEXIT_CRITICAL();
+    }
+}
+
+Watchdog::Diagnostics const& Watchdog::getDiagnostics() const
+{
+    return diagnostics_;
+}
+
+void Watchdog::start()
+{
+    ::TickType_t wake( ::xTaskGetTickCount() );
+    while( true )
+    {
+        ::vTaskDelayUntil(&wake, period_);
+        ::TaskHandle_t task( NULL );
+        taskENTER_CRITICAL();
+        ::TickType_t const now( ::xTaskGetTickCount() );
+        for(Heartbeat* heartbeat( head_ ); heartbeat != NULLPTR; heartbeat = heartbeat->next_)
+        {
+            if( (now - heartbeat->last_) > heartbeat->timeout_ )
+            {
+                task = heartbeat->task_;
+                break;
+            }
+        }
+        taskEXIT_CRITICAL();
+        if( task != NULL )
+        {
+            capture(task);
+            api::Runnable* const hook( hook_ );
+            if( hook != NULLPTR )
+            {
+                hook->start();
+            }
+            System::exit(ERROR_WATCHDOG);
+        }
+    }
+}
+
+bool_t Watchdog::construct()
+{
+    bool_t res( false );
+    do
+    {
+        if( !isConstructed() )
+        {
+            break;
+        }
+        if( period_ == 0 )
+        {
+            break;
+        }
+        if( !thread_.isConstructed() )
+        {
+            break;
+        }
+        if( !thread_.setPriority(api::Thread::PRIORITY_MAX) )
+        {
+            break;
+        }
+        // The fast boot executes the supervisor on the first heartbeat
+        #ifndef EOOS_GLOBAL_SYS_ENABLE_FAST_BOOT
+        if( !activate() )
+        {
+            break;
+        }
+        #endif // EOOS_GLOBAL_SYS_ENABLE_FAST_BOOT
+        res = true;
+    } while(false);
+    return res;
+}
+
+bool_t Watchdog::activate()
+{
+    bool_t res( true );
+    taskENTER_CRITICAL();
+    bool_t const isToExecute( !isActive_ );
+    isActive_ = true;
+    taskEXIT_CRITICAL();
+    if( isToExecute )
+    {
+        res = thread_.execute();
+        if( !res )
+        {
+            isActive_ = false;
+        }
+    }
+    return res;
+}
+
+void Watchdog::capture(::TaskHandle_t task)
+{
+    ::TaskHandle_t tasks[Configuration::NUMBER_OF_WATCHDOG_RECORDS];
+    // The timer daemon deletes detached threads, thus the scheduler is suspended
+    // to keep the task handles valid till their states are captured
+    ::vTaskSuspendAll();
+    int32_t const number( ThreadRegistry::getTasks(tasks, Configuration::NUMBER_OF_WATCHDOG_RECORDS) );
+    for(int32_t i( 0 ); i < number; i++)
+    {
+        Record& record( diagnostics_.records[i] );
+        record.task = tasks[i];
+        char_t const* name( ::pcTaskGetName(tasks[i]) );
+        for(int32_t j( 0 ); j < configMAX_TASK_NAME_LEN; j++)
+        {
+            record.name[j] = (name != NULLPTR) ? name[j] : '\0';
+            if( record.name[j] == '\0' )
+            {
+                name = NULLPTR;
+            }
+        }
+        record.name[configMAX_TASK_NAME_LEN - 1] = '\0';
+        record.state = ::eTaskGetState(tasks[i]);
+        record.priority = ::uxTaskPriorityGet(tasks[i]);
+        record.watermark = ::uxTaskGetStackHighWaterMark(tasks[i]);
+    }
+    static_cast<void>( ::xTaskResumeAll() );
+    diagnostics_.number = number;
+    diagnostics_.time = ::xTaskGetTickCount();
+    diagnostics_.task = task;
+}
+
+Watchdog::Heartbeat::Heartbeat(int32_t timeout)
+    : NonCopyable<NoAllocator>()
+    , timeout_( TimeMap::toTicks(timeout) )
+    , last_( 0 )
+    , task_( NULL )
+    , watchdog_( NULLPTR )
+    , next_( NULLPTR ) {
+    setConstructed( timeout_ != 0 );
+}
+
+Watchdog::Heartbeat::~Heartbeat()
+{
+    if( watchdog_ != NULLPTR )
+    {
+        static_cast<void>( watchdog_->remove(*this) );
+    }
+}
+
+bool_t Watchdog::Heartbeat::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+void Watchdog::Heartbeat::beat()
+{
+    last_ = ::xTaskGetTickCount();
+}
+
+} // namespace sys
+} // namespace eoos
+
+#endif // EOOS_GLOBAL_SYS_ENABLE_WATCHDOG
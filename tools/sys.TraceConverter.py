@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+"""
+@file      sys.TraceConverter.py
+@author    Sergey Baigudin, sergey@baigudin.software
+@copyright 2024, Sergey Baigudin, Baigudin Software
+
+@brief Converts an EOOS kernel trace buffer dump to the Chrome trace JSON format.
+
+The input is a raw little-endian dump of TraceRecorder::Record items, i.e. three
+32-bit words per record: time, object and event. The output can be opened by
+chrome://tracing or https://ui.perfetto.dev.
+
+Usage:
+    sys.TraceConverter.py dump.bin trace.json --frequency HZ [--head N] [--stats]
+
+    --frequency  Frequency of the run time counter which stamps the records in Hz.
+    --head       Value of TraceRecorder::head_ if the whole ring buffer is dumped,
+                 to restore the order of records.
+    --stats      Print min/avg/p99/max and histograms of the system tick and SVC/PendSV
+                 interrupt durations, of the Scheduler::yieldThread() round-trip, and of
+                 the latency from a semaphore released by SemaphoreResource::releaseFromInterrupt()
+                 to a task waiting for the semaphore switched in.
+
+The task woken by a release is matched by the blocking records of the tasks: a task which
+blocks on receiving from the semaphore waits for it till it receives from the semaphore,
+and the first of the tasks waiting at the release which is switched in is the woken one.
+The tool measures traces only, the load shall be generated by a program on the target
+or on the host simulator build.
+"""
+import argparse
+import json
+import struct
+
+RECORD = struct.Struct('<III')
+
+TASK_SWITCHED_IN = 1
+TASK_SWITCHED_OUT = 2
+TASK_CREATE = 3
+TASK_DELETE = 4
+TASK_INCREMENT_TICK = 5
+ISR_TIMER_ENTER = 14
+ISR_TIMER_EXIT = 15
+ISR_SVCALL_ENTER = 16
+ISR_SVCALL_EXIT = 17
+QUEUE_RECEIVE = 9
+QUEUE_RECEIVE_FAILED = 10
+QUEUE_BLOCKING_ON_RECEIVE = 13
+SEMAPHORE_RELEASE_FROM_ISR = 18
+YIELD_ENTER = 19
+YIELD_EXIT = 20
+
+INSTANT_EVENTS = {
+    TASK_CREATE: 'Task create',
+    TASK_DELETE: 'Task delete',
+    TASK_INCREMENT_TICK: 'Tick',
+    6: 'Queue send',
+    7: 'Queue send failed',
+    8: 'Queue send from ISR',
+    9: 'Queue receive',
+    10: 'Queue receive failed',
+    11: 'Queue receive from ISR',
+    12: 'Blocking on queue send',
+    13: 'Blocking on queue receive',
+    SEMAPHORE_RELEASE_FROM_ISR: 'Semaphore release from ISR',
+    YIELD_ENTER: 'Yield',
+    YIELD_EXIT: 'Yield return',
+}
+
+ISR_EVENTS = {
+    ISR_TIMER_ENTER: ('B', 'SchedulerRoutineTimer'),
+    ISR_TIMER_EXIT: ('E', 'SchedulerRoutineTimer'),
+    ISR_SVCALL_ENTER: ('B', 'SchedulerRoutineSvcall'),
+    ISR_SVCALL_EXIT: ('E', 'SchedulerRoutineSvcall'),
+}
+
+ISR_TID = 0
+
+HISTOGRAM_BINS = 10
+
+
+def read_records(path, head):
+    with open(path, 'rb') as file:
+        data = file.read()
+    count = len(data) // RECORD.size
+    records = [RECORD.unpack_from(data, i * RECORD.size) for i in range(count)]
+    if head is not None and count > 0:
+        start = head % count
+        records = records[start:] + records[:start]
+    return records
+
+
+def convert(records, frequency):
+    events = []
+    scale = 1000000.0 / frequency
+    for time, obj, event in unwrap(records):
+        ts = time * scale
+        if event == TASK_SWITCHED_IN:
+            events.append({'name': 'Task 0x%08X' % obj, 'ph': 'B', 'ts': ts, 'pid': 1, 'tid': obj})
+        elif event == TASK_SWITCHED_OUT:
+            events.append({'name': 'Task 0x%08X' % obj, 'ph': 'E', 'ts': ts, 'pid': 1, 'tid': obj})
+        elif event in ISR_EVENTS:
+            phase, name = ISR_EVENTS[event]
+            events.append({'name': name, 'ph': phase, 'ts': ts, 'pid': 1, 'tid': ISR_TID})
+        elif event in INSTANT_EVENTS:
+            isr = event in (TASK_INCREMENT_TICK, SEMAPHORE_RELEASE_FROM_ISR)
+            events.append({'name': INSTANT_EVENTS[event], 'ph': 'i', 's': 't', 'ts': ts, 'pid': 1,
+                           'tid': ISR_TID if isr else obj,
+                           'args': {'object': '0x%08X' % obj}})
+    events.append({'name': 'thread_name', 'ph': 'M', 'pid': 1, 'tid': ISR_TID, 'args': {'name': 'Interrupts'}})
+    return {'traceEvents': events, 'displayTimeUnit': 'ns'}
+
+
+def unwrap(records):
+    base = 0
+    last = None
+    for time, obj, event in records:
+        if last is not None and time < last:
+            base += 1 << 32
+        last = time
+        yield base + time, obj, event
+
+
+def measure(records):
+    samples = {
+        'SchedulerRoutineTimer duration': [],
+        'SchedulerRoutineSvcall duration': [],
+        'Scheduler::yieldThread() round-trip': [],
+        'Release from ISR to waiting task switched in': [],
+    }
+    timer = None
+    svcall = None
+    yields = {}
+    current = None
+    waiting = {}
+    releases = []
+    for time, obj, event in unwrap(records):
+        if event == ISR_TIMER_ENTER:
+            timer = time
+        elif event == ISR_TIMER_EXIT and timer is not None:
+            samples['SchedulerRoutineTimer duration'].append(time - timer)
+            timer = None
+        elif event == ISR_SVCALL_ENTER:
+            svcall = time
+        elif event == ISR_SVCALL_EXIT and svcall is not None:
+            samples['SchedulerRoutineSvcall duration'].append(time - svcall)
+            svcall = None
+        elif event == YIELD_ENTER:
+            yields[obj] = time
+        elif event == YIELD_EXIT and obj in yields:
+            samples['Scheduler::yieldThread() round-trip'].append(time - yields.pop(obj))
+        elif event == QUEUE_BLOCKING_ON_RECEIVE and current is not None:
+            waiting.setdefault(obj, set()).add(current)
+        elif event in (QUEUE_RECEIVE, QUEUE_RECEIVE_FAILED) and current is not None:
+            waiting.get(obj, set()).discard(current)
+        elif event == SEMAPHORE_RELEASE_FROM_ISR and waiting.get(obj):
+            releases.append((time, obj, set(waiting[obj])))
+        elif event == TASK_SWITCHED_IN:
+            current = obj
+            for release in releases:
+                if obj in release[2]:
+                    samples['Release from ISR to waiting task switched in'].append(time - release[0])
+                    waiting[release[1]].discard(obj)
+                    releases.remove(release)
+                    break
+    return samples
+
+
+def report(samples, frequency):
+    scale = 1000000.0 / frequency
+    for name, values in samples.items():
+        print('%s:' % name)
+        if not values:
+            print('  no samples')
+            continue
+        values = sorted(v * scale for v in values)
+        count = len(values)
+        p99 = values[min(count - 1, int(count * 0.99))]
+        print('  count %d, min %.3f us, avg %.3f us, p99 %.3f us, max %.3f us'
+              % (count, values[0], sum(values) / count, p99, values[-1]))
+        low = values[0]
+        width = (values[-1] - low) / HISTOGRAM_BINS or 1.0
+        bins = [0] * HISTOGRAM_BINS
+        for value in values:
+            bins[min(HISTOGRAM_BINS - 1, int((value - low) / width))] += 1
+        for i, number in enumerate(bins):
+            bar = '#' * int(round(50.0 * number / count))
+            print('  %10.3f us | %-50s %d' % (low + i * width, bar, number))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert an EOOS kernel trace dump to Chrome trace JSON.')
+    parser.add_argument('input', help='raw dump of the trace buffer')
+    parser.add_argument('output', help='Chrome trace JSON file')
+    parser.add_argument('--frequency', type=float, required=True, help='run time counter frequency in Hz')
+    parser.add_argument('--head', type=int, default=None, help='TraceRecorder::head_ value of a ring buffer dump')
+    parser.add_argument('--stats', action='store_true', help='print latency statistics')
+    args = parser.parse_args()
+    records = read_records(args.input, args.head)
+    with open(args.output, 'w') as file:
+        json.dump(convert(records, args.frequency), file, indent=1)
+    if args.stats:
+        report(measure(records), args.frequency)
+
+
+if __name__ == '__main__':
+    main()